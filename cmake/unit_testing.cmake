@@ -10,6 +10,7 @@ enable_testing()
 # Unit testing directories
 #######################################################################
 
+add_subdirectory( src/resonanceReconstruction/breitWigner/faddeeva/test )
 add_subdirectory( src/resonanceReconstruction/breitWigner/multiLevel/Apply/test )
 add_subdirectory( src/resonanceReconstruction/breitWigner/multiLevel/Resonance/test )
 add_subdirectory( src/resonanceReconstruction/breitWigner/multiLevel/Type/test )
@@ -24,17 +25,23 @@ add_subdirectory( src/resonanceReconstruction/rmatrix/ChannelQuantumNumbers/test
 add_subdirectory( src/resonanceReconstruction/rmatrix/ChannelRadii/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/ChannelRadiusTable/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/CompoundSystem/test )
+add_subdirectory( src/resonanceReconstruction/rmatrix/CoulombFunctionTable/test )
+add_subdirectory( src/resonanceReconstruction/rmatrix/CrossSectionTable/test )
+add_subdirectory( src/resonanceReconstruction/rmatrix/DopplerBroadener/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/LMatrixCalculator/Constant/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/LMatrixCalculator/ShiftFactor/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/Particle/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/ParticleChannelData/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/ParticlePair/test )
+add_subdirectory( src/resonanceReconstruction/rmatrix/ReactionIndex/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/Resonance/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/ResonanceTable/test )
+add_subdirectory( src/resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/SpinGroup/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/Data/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/resolved/CompoundSystem/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/resolved/Resonance/test )
+add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/resolved/ResonanceConstants/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/MultiLevelBreitWigner/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/SingleLevelBreitWigner/test )
 add_subdirectory( src/resonanceReconstruction/rmatrix/legacy/unresolved/CompoundSystem/test )
@@ -1,9 +1,20 @@
 #ifndef NJOY_RESONANCE_RECONSTRUCTION
 #define NJOY_RESONANCE_RECONSTRUCTION
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <complex>
+#include <exception>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <system_error>
+#include <thread>
 
 #include "interpolation.hpp"
 #include "dimwits.hpp"
@@ -64,6 +75,10 @@ using namespace dimwits;
 
 constexpr double pi = 3.141592653589793;
 
+// Boltzmann constant in eV K^-1 - taken from 2018 CODATA
+using ElectronVoltPerKelvin = decltype( electronVolt / kelvin );
+constexpr Quantity< ElectronVoltPerKelvin > boltzmann = 8.617333262e-5 * electronVolt / kelvin;
+
 using Matrix3x3 = Eigen::Matrix3cd;
 using RootBarn = decltype( unit::sqrt( Barns() ) );
 using RootBarns = RootBarn;
@@ -84,6 +99,7 @@ using Integer = std::integral_constant< int, i >;
 #include "resonanceReconstruction/src/channelRadius.hpp"
 #include "resonanceReconstruction/src/root.hpp"
 #include "resonanceReconstruction/src/neutronWaveNumber.hpp"
+#include "resonanceReconstruction/src/hardSphereFunctions.hpp"
 #include "resonanceReconstruction/src/penetrationShift.hpp"
 #include "resonanceReconstruction/src/phaseShift.hpp"
 
@@ -125,6 +141,7 @@ using EtaParameter = Quantity< CoulombSquaredSecondPerMeter >;
 using Width = Quantity< ElectronVolt >;
 using ReducedWidth = Quantity< RootElectronVolt >;
 using FluctuationIntegral = Quantity< InvElectronVolt >;
+using Temperature = Quantity< Kelvin >;
 
 #include "resonanceReconstruction/rmatrix.hpp"
 }
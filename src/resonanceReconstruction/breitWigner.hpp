@@ -1,5 +1,7 @@
 namespace breitWigner {
 
+#include "resonanceReconstruction/breitWigner/faddeeva.hpp"
+#include "resonanceReconstruction/breitWigner/DopplerPsiChi.hpp"
 #include "resonanceReconstruction/breitWigner/src/psiChi.hpp"
 #include "resonanceReconstruction/breitWigner/CrossSection.hpp"
 
@@ -0,0 +1,29 @@
+/* The Doppler broadened line shapes for a given Doppler width
+ *
+ *   Delta = sqrt( 4 kT E / A )
+ *
+ * are given in terms of the Faddeeva function w( z ) = exp( -z^2 ) erfc( -iz )
+ * by
+ *
+ *   psi + i chi = sqrt( pi ) / 2 xi w( xi / 2 ( x + i ) )
+ *
+ * with x = 2 ( E - Er ) / Gamma and xi = Gamma / Delta. These reduce to the
+ * natural line shapes when Delta goes to zero (which is also used for a zero
+ * Doppler width). The approximation of the Faddeeva function determines the
+ * accuracy and the cost of the evaluation (see faddeeva::Humlicek and
+ * faddeeva::Weideman).
+ *
+ * The line shapes can be evaluated for a single resonance or for a number of
+ * resonances at once, in which case the Faddeeva function is evaluated for
+ * all of them in a single call.
+ */
+template< typename Faddeeva >
+class DopplerPsiChi {
+  Quantity< ElectronVolts > energy;
+  Quantity< ElectronVolts > dopplerWidth;
+  Faddeeva faddeeva;
+
+public:
+  #include "resonanceReconstruction/breitWigner/DopplerPsiChi/src/ctor.hpp"
+  #include "resonanceReconstruction/breitWigner/DopplerPsiChi/src/call.hpp"
+};
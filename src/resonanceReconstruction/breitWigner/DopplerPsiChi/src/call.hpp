@@ -0,0 +1,58 @@
+auto operator()( const Quantity< ElectronVolts > primedResonanceEnergy,
+                 const Quantity< InvElectronVolts > inverseTotalWidth ) const {
+  const double x =
+    2. * ( this->energy - primedResonanceEnergy ) * inverseTotalWidth;
+
+  if ( this->dopplerWidth.value == 0. ){
+    const auto psi = 1. / ( 1. + ( x * x ) );
+    return std::array< double, 2 >{{ psi, x * psi }};
+  }
+
+  const double xi = 1. / ( inverseTotalWidth * this->dopplerWidth );
+  const auto w = this->faddeeva( std::complex< double >( 0.5 * xi * x,
+                                                         0.5 * xi ) );
+  const double scaling = 0.5 * std::sqrt( pi ) * xi;
+  return std::array< double, 2 >{{ scaling * w.real(),
+                                   scaling * w.imag() }};
+}
+
+/* The line shapes for a number of resonances, given by their primed resonance
+ * energies (in eV) and inverse total widths (in 1/eV). The arguments of the
+ * Faddeeva function are stored in psi and chi, after which the Faddeeva
+ * function is evaluated in place for all resonances at once.
+ */
+void operator()( const std::size_t size,
+                 const double* primedResonanceEnergies,
+                 const double* inverseTotalWidths,
+                 double* psi, double* chi ) const {
+  const double energy = this->energy.value;
+  const double dopplerWidth = this->dopplerWidth.value;
+
+  if ( dopplerWidth == 0. ){
+    for ( std::size_t i = 0; i < size; ++i ){
+      const double x =
+        2. * ( energy - primedResonanceEnergies[i] ) * inverseTotalWidths[i];
+      psi[i] = 1. / ( 1. + ( x * x ) );
+      chi[i] = x * psi[i];
+    }
+    return;
+  }
+
+  for ( std::size_t i = 0; i < size; ++i ){
+    const double x =
+      2. * ( energy - primedResonanceEnergies[i] ) * inverseTotalWidths[i];
+    const double xi = 1. / ( inverseTotalWidths[i] * dopplerWidth );
+    psi[i] = 0.5 * xi * x;
+    chi[i] = 0.5 * xi;
+  }
+
+  this->faddeeva( size, psi, chi, psi, chi );
+
+  const double rootPi = std::sqrt( pi );
+  for ( std::size_t i = 0; i < size; ++i ){
+    const double scaling =
+      0.5 * rootPi / ( inverseTotalWidths[i] * dopplerWidth );
+    psi[i] *= scaling;
+    chi[i] *= scaling;
+  }
+}
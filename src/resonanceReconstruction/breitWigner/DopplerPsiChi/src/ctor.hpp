@@ -0,0 +1,4 @@
+DopplerPsiChi( const Quantity< ElectronVolts > energy,
+               const Quantity< ElectronVolts > dopplerWidth,
+               const Faddeeva& faddeeva ) :
+  energy( energy ), dopplerWidth( dopplerWidth ), faddeeva( faddeeva ){}
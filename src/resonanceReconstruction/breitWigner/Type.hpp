@@ -7,4 +7,5 @@ protected:
 
   #include "resonanceReconstruction/breitWigner/Type/src/ctor.hpp"
   #include "resonanceReconstruction/breitWigner/Type/src/neutronWaveNumber.hpp"
+  #include "resonanceReconstruction/breitWigner/Type/src/kernel.hpp"
 };
@@ -0,0 +1,22 @@
+/* The line shapes used to evaluate the cross sections: the natural line
+ * shapes when only the energy is given and the Doppler broadened line shapes
+ * when a temperature is given as well (optionally followed by the
+ * approximation of the Faddeeva function to be used, see psiChi). The Doppler
+ * width Delta = sqrt( 4 kT E / A ) uses the target to neutron mass ratio A,
+ * obtained from A / ( A + 1 ).
+ */
+auto kernel( const Quantity< ElectronVolts > energy ) const {
+  return psiChi( energy );
+}
+
+template< typename... Faddeeva >
+auto kernel( const Quantity< ElectronVolts > energy,
+             const Quantity< Kelvin > temperature,
+             const Faddeeva&... faddeeva ) const {
+  const double awr =
+    target2CompoundWeightRatio / ( 1. - target2CompoundWeightRatio );
+  const double kT = boltzmann.value * temperature.value;
+  const Quantity< ElectronVolts > dopplerWidth =
+    std::sqrt( 4. * kT * energy.value / awr ) * electronVolts;
+  return psiChi( energy, dopplerWidth, faddeeva... );
+}
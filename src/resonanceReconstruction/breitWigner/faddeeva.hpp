@@ -0,0 +1,6 @@
+namespace faddeeva {
+
+#include "resonanceReconstruction/breitWigner/faddeeva/Humlicek.hpp"
+#include "resonanceReconstruction/breitWigner/faddeeva/Weideman.hpp"
+
+}
@@ -0,0 +1,14 @@
+/**
+ *  @class
+ *  @brief Humlicek's rational approximation of the Faddeeva function
+ *
+ *  The Faddeeva function w( z ) = exp( -z^2 ) erfc( -iz ) is approximated in
+ *  the upper half of the complex plane using the four region approximation
+ *  of J. Humlicek, J. Quant. Spectrosc. Radiat. Transfer 27 (1982) 437. The
+ *  relative error is about 5e-5, which makes this the fastest but least
+ *  accurate approximation for a single argument.
+ */
+class Humlicek {
+public:
+  #include "resonanceReconstruction/breitWigner/faddeeva/Humlicek/src/call.hpp"
+};
@@ -0,0 +1,45 @@
+std::complex< double > operator()( const std::complex< double > z ) const {
+  const double x = z.real();
+  const double y = z.imag();
+  const std::complex< double > t( y, -x );
+  const double s = std::abs( x ) + y;
+
+  if ( s >= 15. ) {
+    return t * 0.5641896 / ( 0.5 + t * t );
+  }
+  if ( s >= 5.5 ) {
+    const auto u = t * t;
+    return t * ( 1.410474 + u * 0.5641896 ) / ( 0.75 + u * ( 3. + u ) );
+  }
+  if ( y >= 0.195 * std::abs( x ) - 0.176 ) {
+    return ( 16.4955 + t * ( 20.20933 + t * ( 11.96482
+             + t * ( 3.778987 + t * 0.5642236 ) ) ) )
+           / ( 16.4955 + t * ( 38.82363 + t * ( 39.27121
+               + t * ( 21.69274 + t * ( 6.699398 + t ) ) ) ) );
+  }
+  const auto u = t * t;
+  return std::exp( u )
+         - t * ( 36183.31 - u * ( 3321.9905 - u * ( 1540.787
+                 - u * ( 219.0313 - u * ( 35.76683 - u * ( 1.320522
+                 - u * 0.56419 ) ) ) ) ) )
+           / ( 32066.6 - u * ( 24322.84 - u * ( 9022.228
+               - u * ( 2186.181 - u * ( 364.2191 - u * ( 61.57037
+               - u * ( 1.841439 - u ) ) ) ) ) ) );
+}
+
+/* Evaluate the Faddeeva function for a number of arguments z = x + iy at once
+ *
+ * This uses the same interface as faddeeva::Weideman so that both can be used
+ * for the Doppler broadened line shapes. The region selection requires
+ * branching so that the arguments are simply evaluated one at a time. The
+ * results may be written into the arrays holding the arguments.
+ */
+void operator()( const std::size_t size,
+                 const double* x, const double* y,
+                 double* real, double* imag ) const {
+  for ( std::size_t i = 0; i < size; ++i ){
+    const auto w = ( *this )( std::complex< double >( x[i], y[i] ) );
+    real[i] = w.real();
+    imag[i] = w.imag();
+  }
+}
@@ -0,0 +1,23 @@
+/**
+ *  @class
+ *  @brief Weideman's rational approximation of the Faddeeva function
+ *
+ *  The Faddeeva function w( z ) = exp( -z^2 ) erfc( -iz ) is approximated in
+ *  the upper half of the complex plane by a polynomial of degree N - 1 in
+ *  Z = ( L + iz ) / ( L - iz ) with L = ( N / sqrt( 2 ) )^( 1 / 2 ), see
+ *  J.A.C. Weideman, SIAM J. Numer. Anal. 31 (1994) 1497:
+ *
+ *    w( z ) = 2 p( Z ) / ( L - iz )^2 + 1 / ( sqrt( pi ) ( L - iz ) )
+ *
+ *  The evaluation does not require any branching. The function can also be
+ *  evaluated for many arguments at once, in which case the loops over these
+ *  arguments can be vectorised by the compiler. The relative error is about
+ *  4e-7 for N = 16 and about 3e-13 for N = 32.
+ */
+template< int N >
+class Weideman {
+  #include "resonanceReconstruction/breitWigner/faddeeva/Weideman/src/coefficients.hpp"
+
+public:
+  #include "resonanceReconstruction/breitWigner/faddeeva/Weideman/src/call.hpp"
+};
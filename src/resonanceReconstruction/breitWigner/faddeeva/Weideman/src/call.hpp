@@ -0,0 +1,96 @@
+std::complex< double > operator()( const std::complex< double > z ) const {
+  const double L = std::sqrt( N / std::sqrt( 2. ) );
+  const double x = z.real();
+  const double y = z.imag();
+
+  // 1 / ( L - iz ) = ( ( L + y ) + ix ) / ( ( L + y )^2 + x^2 )
+  const double denominator = 1. / ( ( L + y ) * ( L + y ) + x * x );
+  const double inverseReal = ( L + y ) * denominator;
+  const double inverseImag = x * denominator;
+
+  // Z = ( L + iz ) / ( L - iz ) with L + iz = ( L - y ) + ix
+  const double zReal = ( L - y ) * inverseReal - x * inverseImag;
+  const double zImag = ( L - y ) * inverseImag + x * inverseReal;
+
+  // p( Z ) using Horner's scheme
+  double pReal = a[ N - 1 ];
+  double pImag = 0.;
+  for ( int n = N - 2; n >= 0; --n ){
+    const double real = pReal * zReal - pImag * zImag + a[ n ];
+    pImag = pReal * zImag + pImag * zReal;
+    pReal = real;
+  }
+
+  // 1 / ( L - iz )^2
+  const double squareReal = inverseReal * inverseReal
+                            - inverseImag * inverseImag;
+  const double squareImag = 2. * inverseReal * inverseImag;
+
+  constexpr double inverseRootPi = 0.5641895835477563;
+  return { 2. * ( pReal * squareReal - pImag * squareImag )
+           + inverseRootPi * inverseReal,
+           2. * ( pReal * squareImag + pImag * squareReal )
+           + inverseRootPi * inverseImag };
+}
+
+/* Evaluate the Faddeeva function for a number of arguments z = x + iy at once
+ *
+ * The arguments are processed in chunks, and every step of the evaluation
+ * (including each step of Horner's scheme) is performed for all arguments in
+ * a chunk before moving on to the next one. The loops over the arguments
+ * therefore do not contain any branching and can be vectorised by the
+ * compiler. The results are the same as the ones obtained for each argument
+ * separately and may be written into the arrays holding the arguments.
+ */
+void operator()( const std::size_t size,
+                 const double* x, const double* y,
+                 double* real, double* imag ) const {
+  constexpr std::size_t chunk = 64;
+  const double L = std::sqrt( N / std::sqrt( 2. ) );
+
+  std::array< double, chunk > inverseReal, inverseImag;
+  std::array< double, chunk > zReal, zImag;
+  std::array< double, chunk > pReal, pImag;
+  for ( std::size_t offset = 0; offset < size; offset += chunk ){
+    const std::size_t number = std::min( chunk, size - offset );
+    const double* xs = x + offset;
+    const double* ys = y + offset;
+
+    // 1 / ( L - iz ) and Z = ( L + iz ) / ( L - iz )
+    for ( std::size_t i = 0; i < number; ++i ){
+      const double denominator =
+        1. / ( ( L + ys[i] ) * ( L + ys[i] ) + xs[i] * xs[i] );
+      inverseReal[i] = ( L + ys[i] ) * denominator;
+      inverseImag[i] = xs[i] * denominator;
+      zReal[i] = ( L - ys[i] ) * inverseReal[i] - xs[i] * inverseImag[i];
+      zImag[i] = ( L - ys[i] ) * inverseImag[i] + xs[i] * inverseReal[i];
+      pReal[i] = a[ N - 1 ];
+      pImag[i] = 0.;
+    }
+
+    // p( Z ) using Horner's scheme
+    for ( int n = N - 2; n >= 0; --n ){
+      const double coefficient = a[ n ];
+      for ( std::size_t i = 0; i < number; ++i ){
+        const double value = pReal[i] * zReal[i] - pImag[i] * zImag[i]
+                             + coefficient;
+        pImag[i] = pReal[i] * zImag[i] + pImag[i] * zReal[i];
+        pReal[i] = value;
+      }
+    }
+
+    // 2 p( Z ) / ( L - iz )^2 + 1 / ( sqrt( pi ) ( L - iz ) )
+    constexpr double inverseRootPi = 0.5641895835477563;
+    double* reals = real + offset;
+    double* imags = imag + offset;
+    for ( std::size_t i = 0; i < number; ++i ){
+      const double squareReal = inverseReal[i] * inverseReal[i]
+                                - inverseImag[i] * inverseImag[i];
+      const double squareImag = 2. * inverseReal[i] * inverseImag[i];
+      reals[i] = 2. * ( pReal[i] * squareReal - pImag[i] * squareImag )
+                 + inverseRootPi * inverseReal[i];
+      imags[i] = 2. * ( pReal[i] * squareImag + pImag[i] * squareReal )
+                 + inverseRootPi * inverseImag[i];
+    }
+  }
+}
@@ -0,0 +1,29 @@
+/* The coefficients of the polynomial are the Fourier coefficients of
+ *
+ *   f( t ) = exp( -t^2 ) ( L^2 + t^2 )  with  t = L tan( theta / 2 )
+ *
+ * calculated using 4N equidistant values of theta in [ -pi, pi [. They are
+ * only calculated once.
+ */
+static std::array< double, N > coefficients(){
+  constexpr int M = 2 * N;
+  const double L = std::sqrt( N / std::sqrt( 2. ) );
+
+  std::array< double, 2 * M > f{};
+  for ( int k = -M + 1; k < M; ++k ){
+    const double t = L * std::tan( 0.5 * k * pi / M );
+    f[ k + M ] = std::exp( -t * t ) * ( L * L + t * t );
+  }
+
+  std::array< double, N > a{};
+  for ( int n = 1; n <= N; ++n ){
+    double sum = 0.;
+    for ( int k = -M + 1; k < M; ++k ){
+      sum += f[ k + M ] * std::cos( pi * n * k / M );
+    }
+    a[ n - 1 ] = sum / ( 2 * M );
+  }
+  return a;
+}
+
+static inline const std::array< double, N > a = coefficients();
@@ -0,0 +1,78 @@
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+namespace {
+
+/* reference values of the Faddeeva function */
+const std::vector< std::array< double, 4 > > reference = {
+  //  x       y       Re w( x + iy )            Im w( x + iy )
+  {{  0.0,    0.0,    1.0,                      0.0                     }},
+  {{  0.0,    1.0,    4.2758357615580700e-01,   0.0                     }},
+  {{  1.0,    1.0,    3.0474420525691259e-01,   2.0821893820283163e-01  }},
+  {{ -3.0,    0.5,    3.7126366054692345e-02,  -1.9298375530036209e-01  }},
+  {{  0.5,    1e-6,   7.7880013361780007e-01,   4.7892439410106405e-01  }},
+  {{  5.5,    1e-3,   1.9662633041196526e-05,   1.0436743265973159e-01  }},
+  {{  20.,    1.0,    1.4122347663929661e-03,   2.8173995667521983e-02  }},
+  {{  100.,   0.01,   5.6427422750508775e-07,   5.6421779161582479e-03  }},
+  {{  2.0,    10.,    5.4030407608445584e-02,   1.0704450344460239e-02  }} };
+
+template< typename Faddeeva >
+void test( const Faddeeva& faddeeva, double epsilon ){
+  for ( const auto& values : reference ){
+    const auto w = faddeeva( std::complex< double >( values[0], values[1] ) );
+    const double modulus = std::abs( std::complex< double >( values[2],
+                                                             values[3] ) );
+    REQUIRE( std::abs( w.real() - values[2] ) <= epsilon * modulus );
+    REQUIRE( std::abs( w.imag() - values[3] ) <= epsilon * modulus );
+
+    /* symmetry: w( -x + iy ) = conj( w( x + iy ) ) */
+    const auto mirror = faddeeva( std::complex< double >( -values[0],
+                                                          values[1] ) );
+    REQUIRE( std::abs( mirror.real() - w.real() ) <= epsilon * modulus );
+    REQUIRE( std::abs( mirror.imag() + w.imag() ) <= epsilon * modulus );
+  }
+}
+
+/* the evaluation for many arguments at once agrees with the evaluation for
+   each argument separately (also when the results overwrite the arguments) */
+template< typename Faddeeva >
+void batch( const Faddeeva& faddeeva ){
+  const std::size_t size = 150;
+  std::vector< double > x( size ), y( size ), real( size ), imag( size );
+  for ( std::size_t i = 0; i < size; ++i ){
+    x[i] = -60. + 0.8123 * i;
+    y[i] = std::pow( 10., -6. + 0.05 * i );
+  }
+  faddeeva( size, x.data(), y.data(), real.data(), imag.data() );
+
+  auto xs = x;
+  auto ys = y;
+  faddeeva( size, xs.data(), ys.data(), xs.data(), ys.data() );
+
+  for ( std::size_t i = 0; i < size; ++i ){
+    const auto w = faddeeva( std::complex< double >( x[i], y[i] ) );
+    const double modulus = std::abs( w );
+    REQUIRE( std::abs( real[i] - w.real() ) <= 1e-14 * modulus );
+    REQUIRE( std::abs( imag[i] - w.imag() ) <= 1e-14 * modulus );
+    REQUIRE( std::abs( xs[i] - w.real() ) <= 1e-14 * modulus );
+    REQUIRE( std::abs( ys[i] - w.imag() ) <= 1e-14 * modulus );
+  }
+}
+
+}
+
+SCENARIO( "Humlicek" ){
+  test( breitWigner::faddeeva::Humlicek(), 1e-4 );
+  batch( breitWigner::faddeeva::Humlicek() );
+}
+
+SCENARIO( "Weideman" ){
+  test( breitWigner::faddeeva::Weideman< 16 >(), 1e-6 );
+  test( breitWigner::faddeeva::Weideman< 32 >(), 1e-12 );
+  batch( breitWigner::faddeeva::Weideman< 16 >() );
+  batch( breitWigner::faddeeva::Weideman< 32 >() );
+}
@@ -1,6 +1,6 @@
-template< typename ChannelRadius >
+template< typename PsiChi, typename ChannelRadius >
 auto evaluate( const Quantity< ElectronVolts > energy,
-               const ResonanceShape& kernel,
+               const PsiChi& kernel,
                const Quantity< RootBarn > channelRadius,
                const Quantity< RootBarn > scatteringRadius,
                ChannelRadius&& a ) const {
@@ -1,5 +1,5 @@
-template< typename CompetitiveWidth = ZeroWidth >
-auto evaluate( const ResonanceShape& kernel,
+template< typename PsiChi, typename CompetitiveWidth = ZeroWidth >
+auto evaluate( const PsiChi& kernel,
                const double channelRatio,
                const double scatteringRatio,
                const double targetSpin,
@@ -23,30 +23,57 @@ auto evaluate( const ResonanceShape& kernel,
         return reference.statisticalFactor == trial.statisticalFactor;
       } );
 
-  const auto zero = pack( pack( 0., 0. ), 0., 0. );
+  const auto zero = pack( pack( 0., 0. ), 0., 0., 0. );
+
+  /* The line shapes of the resonances in a J group are evaluated together
+   * (see psiChi), in chunks of a fixed size so that no memory needs to be
+   * allocated.
+   */
+  constexpr std::size_t chunk = 64;
 
   const auto crossSections =
     Jgroups
     | ranges::view::transform( [&]( const auto& Jgroup ){
-        const auto Jresonances =
-          Jgroup
-          | ranges::view::transform(
-              [&]( const auto& resonance ){
-                return resonance( penetrationFactor,
-                                  shiftFactor,
-                                  competitiveWidth( resonance ),
-                                  kernel ); } );
+        std::array< double, chunk > energies, widths, psi, chi;
+
+        auto sum = zero;
+        auto resonance = ranges::begin( Jgroup );
+        const auto end = ranges::end( Jgroup );
+        while ( resonance != end ){
+          auto current = resonance;
+          std::size_t size = 0;
+          for ( ; ( resonance != end ) && ( size < chunk );
+                ++resonance, ++size ){
+            const auto arguments =
+              ( *resonance ).psiChiArguments( penetrationFactor,
+                                              shiftFactor,
+                                              competitiveWidth( *resonance ) );
+            energies[ size ] = arguments[0];
+            widths[ size ] = arguments[1];
+          }
+
+          breitWigner::psiChi( kernel, size, energies.data(), widths.data(),
+                               psi.data(), chi.data() );
+
+          for ( std::size_t i = 0; i < size; ++i, ++current ){
+            sum = sum + ( *current )( penetrationFactor,
+                                      competitiveWidth( *current ),
+                                      std::array< double, 2 >{{ psi[i],
+                                                                chi[i] }} );
+          }
+        }
 
-        const auto Jsum = ranges::accumulate( Jresonances, zero ).data;
+        const auto Jsum = sum.data;
 
         const auto& scatteringComponents = std::get<0>( Jsum ).data;
         const auto& first = std::get<0>( scatteringComponents );
         const auto& second = std::get<1>( scatteringComponents );
 
         const auto scattering = first * ( first - 2 * sinSquaredPhi )
-                                + second * ( second + sin2Phi );
-        const auto capture = std::get<1>( Jsum );
-        const auto fission = std::get<2>( Jsum );
+                                + second * ( second + sin2Phi )
+                                + std::get<1>( Jsum );
+        const auto capture = std::get<2>( Jsum );
+        const auto fission = std::get<3>( Jsum );
 
         return pack( scattering, capture, fission )
                * Jgroup.front().statisticalFactor;
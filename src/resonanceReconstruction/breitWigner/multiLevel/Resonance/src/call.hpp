@@ -1,7 +1,10 @@
-auto operator()( const double penetrationFactor,
+/* The arguments of the line shapes of the resonance: the primed resonance
+ * energy (in eV) and the inverse of the total width (in 1/eV)
+ */
+std::array< double, 2 >
+psiChiArguments( const double penetrationFactor,
                  const double shiftFactor,
-                 const Quantity< ElectronVolts > competitiveWidth,
-                 const ResonanceShape& kernel ) const {
+                 const Quantity< ElectronVolts > competitiveWidth ) const {
   const auto weightedWidth =
     this->neutronWidth * this->inversePenetrationFactor;
 
@@ -17,7 +20,21 @@ auto operator()( const double penetrationFactor,
     this->energy
     + 0.5 * weightedWidth * ( this->shiftFactor - shiftFactor );
 
-  const auto psichi = kernel( primedResonanceEnergy, inverseTotalWidth );
+  return {{ primedResonanceEnergy.value, inverseTotalWidth.value }};
+}
+
+/* The contributions of the resonance for the given line shapes psi and chi */
+auto operator()( const double penetrationFactor,
+                 const Quantity< ElectronVolts > competitiveWidth,
+                 const std::array< double, 2 >& psichi ) const {
+  const auto neutronWidth =
+    this->neutronWidth * this->inversePenetrationFactor * penetrationFactor;
+
+  const auto inverseTotalWidth =
+    1. / ( neutronWidth
+           + this->captureWidth
+           + this->fissionWidth
+           + competitiveWidth );
 
   const double& psi = psichi[0];
   const double& chi = psichi[1];
@@ -25,9 +42,31 @@ auto operator()( const double penetrationFactor,
 
   const auto scattering = pack( psi, chi ) * widthRatio;
 
+  /* The square of the resonance amplitude in the J group sums only equals
+   * the single level line shape for the natural line shapes ( psi^2 + chi^2
+   * = psi ). The difference is added so that the Doppler broadened line
+   * shapes are used for the single level part of the cross section and only
+   * the interference between resonances uses their products.
+   */
+  const double self = widthRatio * widthRatio * ( psi - psi * psi - chi * chi );
+
   const auto scaling = psi * inverseTotalWidth * widthRatio;
   const double capture = scaling * this->captureWidth;
   const double fission = scaling * this->fissionWidth;
 
-  return pack( scattering, capture, fission );
+  return pack( scattering, self, capture, fission );
+}
+
+template< typename PsiChi >
+auto operator()( const double penetrationFactor,
+                 const double shiftFactor,
+                 const Quantity< ElectronVolts > competitiveWidth,
+                 const PsiChi& kernel ) const {
+  const auto arguments =
+    this->psiChiArguments( penetrationFactor, shiftFactor, competitiveWidth );
+
+  const auto psichi = kernel( arguments[0] * electronVolts,
+                              arguments[1] / electronVolt );
+
+  return ( *this )( penetrationFactor, competitiveWidth, psichi );
 }
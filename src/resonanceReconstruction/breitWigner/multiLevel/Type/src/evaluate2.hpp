@@ -3,7 +3,7 @@ auto evaluate( const Quantity<ElectronVolts> energy,
                Args&&... args ) const {
   const auto channelRadius = this->channelRadius( energy );
   const auto scatteringRadius = this->scatteringRadius( energy );
-  const auto kernel = psiChi( energy, args... );
+  const auto kernel = this->kernel( energy, args... );
 
   return Parent::evaluate( energy,
                            kernel,
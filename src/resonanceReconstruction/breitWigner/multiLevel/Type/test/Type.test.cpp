@@ -33,6 +33,27 @@ auto test( const std::vector< double >& testData ){
   };
 }
 
+auto natural( const std::vector< double >& testData ){
+  return [&testData]( auto&& xs ){
+    auto tuples = testData | ranges::view::chunk(4);
+    for( const auto& tuple : tuples ){
+      auto energy = tuple[0] * electronVolts;
+
+      /* the natural line shapes are used at 0 K and are recovered by the
+         Doppler broadened line shapes for a vanishing Doppler width */
+      auto reference = xs( energy );
+      auto cold = xs( energy, 0. * kelvin );
+      auto trial = xs( energy, 1e-6 * kelvin );
+      REQUIRE( reference.elastic.value == Approx( cold.elastic.value ) );
+      REQUIRE( reference.fission.value == Approx( cold.fission.value ) );
+      REQUIRE( reference.capture.value == Approx( cold.capture.value ) );
+      REQUIRE( reference.elastic.value == Approx( trial.elastic.value ) );
+      REQUIRE( reference.fission.value == Approx( trial.fission.value ) );
+      REQUIRE( reference.capture.value == Approx( trial.capture.value ) );
+    }
+  };
+}
+
 SCENARIO( "Integration test" ){
   SECTION( "Cobalt-58" ){
     auto Co58 = resonances("Co-58");
@@ -98,6 +119,46 @@ SCENARIO( "Integration test" ){
   }
 }
 
+SCENARIO( "Doppler broadened evaluation" ){
+  auto Co58 = resonances("Co-58");
+
+  auto& section151 = std::get<0>( Co58 );
+  auto& isotope = section151.isotopes().front();
+  auto& resonanceRange = isotope.resonanceRanges().front();
+  auto& testData = std::get<1>( Co58 );
+
+  breitWigner::multiLevel::Apply{}( resonanceRange, natural( testData ) );
+
+  breitWigner::multiLevel::Apply{}( resonanceRange, [&]( auto&& xs ){
+    /* the resonance at 10.35 eV is lowered at its peak and raised in its
+       wings */
+    const auto peak = 10.35 * electronVolts;
+    const auto wing = 12. * electronVolts;
+    REQUIRE( xs( peak, 300. * kelvin ).capture.value <
+             xs( peak ).capture.value );
+    REQUIRE( xs( wing, 300. * kelvin ).capture.value >
+             xs( wing ).capture.value );
+
+    /* the approximations of the Faddeeva function are consistent */
+    auto tuples = testData | ranges::view::chunk(4);
+    for( const auto& tuple : tuples ){
+      auto energy = tuple[0] * electronVolts;
+
+      const auto reference = xs( energy, 300. * kelvin );
+      const auto fast = xs( energy, 300. * kelvin,
+                            breitWigner::faddeeva::Humlicek() );
+      const auto medium = xs( energy, 300. * kelvin,
+                              breitWigner::faddeeva::Weideman< 16 >() );
+      REQUIRE( fast.elastic.value ==
+               Approx( reference.elastic.value ).epsilon( 1e-3 ) );
+      REQUIRE( fast.capture.value ==
+               Approx( reference.capture.value ).epsilon( 1e-3 ) );
+      REQUIRE( medium.elastic.value == Approx( reference.elastic.value ) );
+      REQUIRE( medium.capture.value == Approx( reference.capture.value ) );
+    }
+  } );
+}
+
 std::pair< njoy::ENDFtk::section::Type< 2, 151 >, std::vector< double > >
 resonances( const std::string& id ){
   auto testData = [&]{
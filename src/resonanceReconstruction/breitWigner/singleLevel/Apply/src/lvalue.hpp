@@ -41,8 +41,9 @@ static auto lvalue( const endf::SingleLevelBreitWigner::LValue& lstate,
     return lvalue( lstate, rho, g, penetrationShift( Integer<3>{} ), targetSpin );
   case 4:
     return lvalue( lstate, rho, g, penetrationShift( Integer<4>{} ), targetSpin );
+  default:
+    return lvalue( lstate, rho, g, PenetrationShift( lstate.L() ), targetSpin );
   }
-  throw std::exception();
 }
 
 template< typename BreitWigner,
@@ -40,6 +40,47 @@ SCENARIO( "Integration test" ){
   }
 }
 
+SCENARIO( "Doppler broadened evaluation" ){
+  const auto Rh105 = resonances();
+  const auto& isotope = Rh105.isotopes().front();
+  const auto& resonanceRange = isotope.resonanceRanges().front();
+  EnergyRange energyRange{ resonanceRange.EL() * electronVolts,
+                           resonanceRange.EH() * electronVolts };
+  const auto& slbw = std::get< 1 >( resonanceRange.parameters() );
+
+  const auto type = Apply().build( energyRange, slbw,
+                                   channelRadius( 104. ), radius( 0.62 ) );
+
+  /* the natural line shapes are used at 0 K */
+  for ( auto energy : energies() ){
+    const auto natural = type( energy );
+    const auto xs = type( energy, 0. * kelvin );
+    REQUIRE( xs.elastic.value == Approx( natural.elastic.value ) );
+    REQUIRE( xs.capture.value == Approx( natural.capture.value ) );
+  }
+
+  /* the resonance at 5 eV is lowered at its peak and raised in its wings */
+  const auto peak = 5. * electronVolts;
+  const auto wing = 6. * electronVolts;
+  REQUIRE( type( peak, 300. * kelvin ).capture.value <
+           type( peak ).capture.value );
+  REQUIRE( type( wing, 300. * kelvin ).capture.value >
+           type( wing ).capture.value );
+
+  /* the approximations of the Faddeeva function are consistent */
+  for ( auto energy : energies() ){
+    const auto xs = type( energy, 300. * kelvin );
+    const auto fast = type( energy, 300. * kelvin,
+                            breitWigner::faddeeva::Humlicek() );
+    const auto medium = type( energy, 300. * kelvin,
+                              breitWigner::faddeeva::Weideman< 16 >() );
+    REQUIRE( fast.elastic.value == Approx( xs.elastic.value ).epsilon( 1e-3 ) );
+    REQUIRE( fast.capture.value == Approx( xs.capture.value ).epsilon( 1e-3 ) );
+    REQUIRE( medium.elastic.value == Approx( xs.elastic.value ) );
+    REQUIRE( medium.capture.value == Approx( xs.capture.value ) );
+  }
+}
+
 std::string Rhodium105Resonances();
 
 njoy::ENDFtk::section::Type< 2, 151 >
@@ -8,3 +8,40 @@ inline auto psiChi( const Quantity<ElectronVolts> energy ){
     return std::array< double, 2 >{{ psi, x * psi }};
   };
 }
+
+/* The Doppler broadened line shapes for a given Doppler width, using the
+ * given approximation of the Faddeeva function (see DopplerPsiChi)
+ */
+template< typename Faddeeva = faddeeva::Weideman< 32 > >
+inline auto psiChi( const Quantity<ElectronVolts> energy,
+                    const Quantity<ElectronVolts> dopplerWidth,
+                    const Faddeeva& faddeeva = Faddeeva() ){
+  return DopplerPsiChi< Faddeeva >( energy, dopplerWidth, faddeeva );
+}
+
+/* The line shapes for a number of resonances, given by their primed resonance
+ * energies (in eV) and inverse total widths (in 1/eV). Line shapes that can
+ * be evaluated for many resonances at once (see DopplerPsiChi) are evaluated
+ * in a single call, the other ones (like the natural line shapes) are
+ * evaluated one resonance at a time.
+ */
+template< typename PsiChi >
+void psiChi( const PsiChi& kernel,
+             const std::size_t size,
+             const double* primedResonanceEnergies,
+             const double* inverseTotalWidths,
+             double* psi, double* chi ){
+  if constexpr ( std::is_invocable_v< const PsiChi&, std::size_t,
+                                      const double*, const double*,
+                                      double*, double* > ){
+    kernel( size, primedResonanceEnergies, inverseTotalWidths, psi, chi );
+  }
+  else {
+    for ( std::size_t i = 0; i < size; ++i ){
+      const auto psichi = kernel( primedResonanceEnergies[i] * electronVolts,
+                                  inverseTotalWidths[i] / electronVolt );
+      psi[i] = psichi[0];
+      chi[i] = psichi[1];
+    }
+  }
+}
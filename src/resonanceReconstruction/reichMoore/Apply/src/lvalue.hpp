@@ -50,8 +50,9 @@ static auto lvalue( const endf::ReichMoore::LValue& lstate,
     return lvalue( lstate, k, r, g, penetrationShift( Integer<3>{} ), useAPL );
   case 4:
     return lvalue( lstate, k, r, g, penetrationShift( Integer<4>{} ), useAPL );
+  default:
+    return lvalue( lstate, k, r, g, PenetrationShift( lstate.L() ), useAPL );
   }
-  throw std::exception();
 }
 
 template< typename WaveNumber,
@@ -17,10 +17,12 @@ namespace rmatrix {
   struct Fission {};
   #include "resonanceReconstruction/rmatrix/src/horner.hpp"
   #include "resonanceReconstruction/rmatrix/src/coh3-coulomb.hpp"
+  #include "resonanceReconstruction/rmatrix/src/calculateHardSphereFunctions.hpp"
   #include "resonanceReconstruction/rmatrix/src/calculatePenetrability.hpp"
   #include "resonanceReconstruction/rmatrix/src/calculateShiftFactor.hpp"
   #include "resonanceReconstruction/rmatrix/src/calculatePhaseShift.hpp"
   #include "resonanceReconstruction/rmatrix/src/calculateCoulombPhaseShift.hpp"
+  #include "resonanceReconstruction/rmatrix/src/calculateWaveFunctionQuantities.hpp"
 
   // identifiers
   using ParticleID = elementary::ParticleID;
@@ -37,6 +39,13 @@ namespace rmatrix {
   // utility code
   #include "resonanceReconstruction/rmatrix/Table.hpp"
   #include "resonanceReconstruction/rmatrix/overload.hpp"
+  #include "resonanceReconstruction/rmatrix/AlignedAllocator.hpp"
+  #include "resonanceReconstruction/rmatrix/src/parallelFor.hpp"
+  #include "resonanceReconstruction/rmatrix/ReactionIndex.hpp"
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable.hpp"
+  #include "resonanceReconstruction/rmatrix/ChannelState.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroupWorkspace.hpp"
+  #include "resonanceReconstruction/rmatrix/EvaluationWorkspace.hpp"
 
   // R-Matrix boundary condition and options
   using BoundaryCondition = double;
@@ -50,6 +59,7 @@ namespace rmatrix {
   #include "resonanceReconstruction/rmatrix/ChannelQuantumNumbers.hpp"
   #include "resonanceReconstruction/rmatrix/ChannelRadiusTable.hpp"
   #include "resonanceReconstruction/rmatrix/ChannelRadii.hpp"
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable.hpp"
   #include "resonanceReconstruction/rmatrix/Channel.hpp"
   #include "resonanceReconstruction/rmatrix/ParticleChannel.hpp"
   #include "resonanceReconstruction/rmatrix/ParticleChannelData.hpp"
@@ -63,6 +73,10 @@ namespace rmatrix {
   struct MultiLevelBreitWigner {};
   struct ReichMoore {};
   struct GeneralRMatrix {};
+
+  // R-matrix calculation options
+  struct ChannelMatrix {};
+  struct LevelMatrix {};
   #include "resonanceReconstruction/rmatrix/RLMatrixCalculator.hpp"
 
   // spin group and compound system
@@ -98,5 +112,6 @@ namespace rmatrix {
                     //CompoundSystem< GeneralRMatrix, Constant >,
                     legacy::unresolved::CompoundSystem >;
   #include "resonanceReconstruction/rmatrix/Reconstructor.hpp"
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener.hpp"
   #include "resonanceReconstruction/rmatrix/src/fromENDF.hpp"
 }
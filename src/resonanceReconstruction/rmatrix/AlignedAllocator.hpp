@@ -0,0 +1,62 @@
+/**
+ *  @class
+ *  @brief Allocator for arrays aligned on a given boundary
+ *
+ *  Arrays allocated with this allocator start on a cache line boundary (by
+ *  default), which allows the compiler to use aligned vector loads when
+ *  looping over them.
+ */
+template < typename T, std::size_t Alignment = 64 >
+struct AlignedAllocator {
+
+  /* type aliases */
+  using value_type = T;
+
+  template < typename U >
+  struct rebind { using other = AlignedAllocator< U, Alignment >; };
+
+  /* constructor */
+  AlignedAllocator() noexcept = default;
+  template < typename U >
+  AlignedAllocator( const AlignedAllocator< U, Alignment >& ) noexcept {}
+
+  /**
+   *  @brief Allocate an aligned array
+   *
+   *  @param[in] size   the number of elements in the array
+   */
+  T* allocate( std::size_t size ) {
+
+    return static_cast< T* >(
+             ::operator new( size * sizeof( T ),
+                             std::align_val_t( Alignment ) ) );
+  }
+
+  /**
+   *  @brief Deallocate an aligned array
+   *
+   *  @param[in] pointer   the array to be deallocated
+   */
+  void deallocate( T* pointer, std::size_t ) noexcept {
+
+    ::operator delete( pointer, std::align_val_t( Alignment ) );
+  }
+
+  template < typename U >
+  bool operator==( const AlignedAllocator< U, Alignment >& ) const noexcept {
+
+    return true;
+  }
+
+  template < typename U >
+  bool operator!=( const AlignedAllocator< U, Alignment >& ) const noexcept {
+
+    return false;
+  }
+};
+
+/**
+ *  @brief A std::vector using aligned storage
+ */
+template < typename T >
+using AlignedVector = std::vector< T, AlignedAllocator< T > >;
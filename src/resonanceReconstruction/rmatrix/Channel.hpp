@@ -20,6 +20,8 @@ class Channel {
 
   double spinfactor_;
 
+  std::shared_ptr< const CoulombFunctionTable > coulomb_;
+
   /* auxiliary functions */
   #include "resonanceReconstruction/rmatrix/Channel/src/makeChannelID.hpp"
   #include "resonanceReconstruction/rmatrix/Channel/src/makeReactionID.hpp"
@@ -98,6 +100,26 @@ public:
    */
   double statisticalSpinFactor() const { return this->spinfactor_; }
 
+  /**
+   *  @brief Return whether or not the channel uses tabulated values for the
+   *         penetrability, shift factor and phase shift
+   */
+  bool isTabulated() const { return bool( this->coulomb_ ); }
+
+  /**
+   *  @brief Return whether or not the derivatives of the penetrability, shift
+   *         factor and phase shift with respect to the incident energy are
+   *         available
+   *
+   *  The derivatives are available for channels with energy independent
+   *  channel radii that do not involve charged particles.
+   */
+  bool hasDerivatives() const {
+
+    return this->radii().isEnergyIndependent() and
+           not std::is_same_v< ChannelType, ChargedParticle >;
+  }
+
   #include "resonanceReconstruction/rmatrix/Channel/src/belowThreshold.hpp"
   #include "resonanceReconstruction/rmatrix/Channel/src/sommerfeldParameter.hpp"
   #include "resonanceReconstruction/rmatrix/Channel/src/waveNumber.hpp"
@@ -105,4 +127,8 @@ public:
   #include "resonanceReconstruction/rmatrix/Channel/src/shiftFactor.hpp"
   #include "resonanceReconstruction/rmatrix/Channel/src/phaseShift.hpp"
   #include "resonanceReconstruction/rmatrix/Channel/src/coulombPhaseShift.hpp"
+  #include "resonanceReconstruction/rmatrix/Channel/src/state.hpp"
+  #include "resonanceReconstruction/rmatrix/Channel/src/states.hpp"
+  #include "resonanceReconstruction/rmatrix/Channel/src/derivatives.hpp"
+  #include "resonanceReconstruction/rmatrix/Channel/src/tabulateCoulombFunctions.hpp"
 };
@@ -0,0 +1,72 @@
+/**
+ *  @brief Return the derivatives of the penetrability, shift factor and phase
+ *         shift with respect to the incident energy
+ *
+ *  For a neutron channel, the logarithmic derivative L = rho O' / O = S + iP
+ *  of the outgoing wave function O satisfies a Riccati equation from which
+ *  the derivatives with respect to rho = ka follow:
+ *    dP/drho = P ( 1 - 2 S ) / rho
+ *    dS/drho = ( S - S^2 + P^2 + l ( l + 1 ) ) / rho - rho
+ *    dphi/drho = P / rho
+ *  in which P and S are evaluated at the value of rho used for the function
+ *  being derived (the penetrability, shift factor and phase shift radius may
+ *  differ). Since k^2 is proportional to energy * ratio + q, we have
+ *  drho/dE = rho ratio / ( 2 ( energy * ratio + q ) ) for energy independent
+ *  channel radii.
+ *
+ *  For photon and fission channels, the penetrability, shift factor and phase
+ *  shift do not depend on the energy. The derivatives for charged particle
+ *  channels are not available since the Coulomb wave functions also depend on
+ *  the energy through the Sommerfeld parameter.
+ *
+ *  @param[in] energy   the incident energy
+ *
+ *  @return the derivatives of the penetrability, shift factor and phase shift
+ *          (in 1/eV)
+ */
+std::array< double, 3 > derivatives( const Energy& energy ) const {
+
+  if ( not this->hasDerivatives() ) {
+
+    Log::error( "The derivatives of the penetrability, shift factor and phase "
+                "shift can only be calculated for energy independent channel "
+                "radii and for channels without charged particles" );
+    Log::info( "Channel: {}", this->channelID() );
+    throw std::exception();
+  }
+
+  if constexpr ( std::is_same_v< ChannelType, Neutron > ) {
+
+    const auto waveNumber = this->waveNumber( energy );
+    const unsigned int l = this->quantumNumbers().orbitalAngularMomentum();
+    const double ratio = this->incidentParticlePair().massRatio();
+    const double d = 0.5 * ratio / ( energy.value * ratio + this->Q().value );
+
+    // P and S at the given value of rho
+    auto functions = [l] ( double rho ) -> std::array< double, 2 > {
+
+      return {{ calculatePenetrability< Neutron >( l, rho, 0. ),
+                calculateShiftFactor< Neutron >( l, rho, 0. ) }};
+    };
+
+    const double penetrability =
+        waveNumber * this->radii().penetrabilityRadius( energy );
+    const double shift =
+        waveNumber * this->radii().shiftFactorRadius( energy );
+    const double phase =
+        waveNumber * this->radii().phaseShiftRadius( energy );
+
+    // the derivatives with respect to E, using drho/dE = rho d
+    const auto p = functions( penetrability );
+    const auto s = functions( shift );
+    const auto phi = functions( phase );
+    return {{ p[0] * ( 1. - 2. * p[1] ) * d,
+              ( s[1] - s[1] * s[1] + s[0] * s[0] + l * ( l + 1. )
+                - shift * shift ) * d,
+              phi[0] * d }};
+  }
+  else {
+
+    return {{ 0., 0., 0. }};
+  }
+}
@@ -5,9 +5,9 @@
  */
 double penetrability( const Energy& energy ) const {
 
-  const double eta = this->sommerfeldParameter( energy );
-  const double ratio = this->waveNumber( energy ) *
-                       this->radii().penetrabilityRadius( energy );
+  const auto k = this->waveNumber( energy );
+  const double eta = this->sommerfeldParameter( k );
+  const double ratio = k * this->radii().penetrabilityRadius( energy );
   const unsigned int l = this->quantumNumbers().orbitalAngularMomentum();
   return calculatePenetrability< ChannelType >( l, ratio, eta );
 }
@@ -5,9 +5,9 @@
  */
 double phaseShift( const Energy& energy ) const {
 
-  const double eta = this->sommerfeldParameter( energy );
-  const double ratio = this->waveNumber( energy ) *
-                       this->radii().phaseShiftRadius( energy );
+  const auto k = this->waveNumber( energy );
+  const double eta = this->sommerfeldParameter( k );
+  const double ratio = k * this->radii().phaseShiftRadius( energy );
   const unsigned int l = this->quantumNumbers().orbitalAngularMomentum();
   return calculatePhaseShift< ChannelType >( l, ratio, eta );
 }
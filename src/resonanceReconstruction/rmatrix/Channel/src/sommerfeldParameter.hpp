@@ -1,6 +1,6 @@
 /**
- *  @brief Return the value of Sommerfeld parameter for the channel at a
- *         given energy
+ *  @brief Return the value of Sommerfeld parameter for the channel for a
+ *         given wave number
  *
  *  The Sommerfeld parameter eta is an energy dependent quantity defined as
  *  follows:
@@ -12,9 +12,9 @@
  *
  *  It is a dimensionless parameter.
  *
- *  @param energy   the energy at which the permeability needs to be evaluated
+ *  @param k   the wave number of the channel (see waveNumber())
  */
-double sommerfeldParameter( const Energy& energy ) const {
+double sommerfeldParameter( const WaveNumber& k ) const {
 
   using ElectronVoltMeter = decltype( electronVolt * meter );
 
@@ -27,8 +27,18 @@ double sommerfeldParameter( const Energy& energy ) const {
   else {
 
     const auto mu = this->particlePair().reducedMass();
-    const auto k = this->waveNumber( energy );
     return Quantity< ElectronVoltMeter >( zZ / ( 4. * pi * epsilon0 ) )
            / Quantity< ElectronVoltMeter >( ( hbar * hbar * k ) / mu );
   }
 }
+
+/**
+ *  @brief Return the value of Sommerfeld parameter for the channel at a
+ *         given energy
+ *
+ *  @param energy   the energy at which the permeability needs to be evaluated
+ */
+double sommerfeldParameter( const Energy& energy ) const {
+
+  return this->sommerfeldParameter( this->waveNumber( energy ) );
+}
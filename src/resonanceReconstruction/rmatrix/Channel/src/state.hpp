@@ -0,0 +1,47 @@
+/**
+ *  @brief Return the state of the channel at a given energy
+ *
+ *  The wave number and Sommerfeld parameter are only calculated once and are
+ *  used for the calculation of the penetrability, shift factor, phase shift
+ *  and coulomb phase shift. For charged particle channels, the Coulomb wave
+ *  functions are shared between the penetrability, shift factor and phase
+ *  shift. The resulting values are identical to the ones returned by the
+ *  individual functions, unless the channel uses a table for the Coulomb
+ *  functions (see tabulateCoulombFunctions()).
+ *
+ *  @param[in] energy   the energy at which the channel state is needed
+ */
+ChannelState state( const Energy& energy ) const {
+
+  const auto k = this->waveNumber( energy );
+  const double eta = this->sommerfeldParameter( k );
+  const double penetrabilityRatio =
+      k * this->radii().penetrabilityRadius( energy );
+  const double shiftFactorRatio =
+      k * this->radii().shiftFactorRadius( energy );
+  const double phaseShiftRatio =
+      k * this->radii().phaseShiftRadius( energy );
+  const unsigned int l = this->quantumNumbers().orbitalAngularMomentum();
+
+  double penetrability, shiftFactor, phaseShift;
+  if ( this->coulomb_ and this->coulomb_->isInside( k.value ) ) {
+
+    const auto values = ( *this->coulomb_ )( k.value );
+    penetrability = values[0];
+    shiftFactor = values[1];
+    phaseShift = values[2];
+  }
+  else {
+
+    calculateWaveFunctionQuantities< ChannelType >(
+        l, penetrabilityRatio, shiftFactorRatio, phaseShiftRatio, eta,
+        penetrability, shiftFactor, phaseShift );
+  }
+
+  return ChannelState{
+           k, eta,
+           penetrabilityRatio, shiftFactorRatio, phaseShiftRatio,
+           penetrability, shiftFactor, phaseShift,
+           calculateCoulombPhaseShift< ChannelType >( l, eta ),
+           this->belowThreshold( energy ) };
+}
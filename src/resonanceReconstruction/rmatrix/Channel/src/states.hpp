@@ -0,0 +1,75 @@
+/**
+ *  @brief Calculate the state of the channel for a range of energies
+ *
+ *  The states for the energies in [first, last) are appended to the given
+ *  vector. For neutron channels, the penetrability, shift factor and phase
+ *  shift for all these energies are calculated at once using
+ *  calculateHardSphereFunctions() so that the loops over the energies can be
+ *  vectorised. The resulting states are identical to the ones returned by
+ *  state().
+ *
+ *  @param[in] energies      the energy grid
+ *  @param[in] first         the index of the first energy
+ *  @param[in] last          the index past the last energy
+ *  @param[in,out] states    the channel states to which the states are added
+ *  @param[in,out] scratch   scratch space for the hard sphere functions
+ */
+template < typename Energies >
+void states( const Energies& energies,
+             const unsigned int first, const unsigned int last,
+             std::vector< ChannelState >& states,
+             AlignedVector< double >& scratch ) const {
+
+  if constexpr ( std::is_same_v< ChannelType, Neutron > ) {
+
+    const unsigned int size = last - first;
+    const unsigned int l = this->quantumNumbers().orbitalAngularMomentum();
+    const std::size_t offset = states.size();
+
+    // the values of rho followed by the penetrability, shift factor and
+    // phase shift for every energy
+    scratch.resize( 6 * size );
+    double* penetrabilityRatios = scratch.data();
+    double* shiftFactorRatios = penetrabilityRatios + size;
+    double* phaseShiftRatios = shiftFactorRatios + size;
+    double* penetrability = phaseShiftRatios + size;
+    double* shiftFactor = penetrability + size;
+    double* phaseShift = shiftFactor + size;
+
+    for ( unsigned int i = 0; i < size; ++i ) {
+
+      const Energy energy = energies[ first + i ];
+      const auto k = this->waveNumber( energy );
+      const double eta = this->sommerfeldParameter( k );
+      penetrabilityRatios[i] = k * this->radii().penetrabilityRadius( energy );
+      shiftFactorRatios[i] = k * this->radii().shiftFactorRadius( energy );
+      phaseShiftRatios[i] = k * this->radii().phaseShiftRadius( energy );
+
+      states.push_back( ChannelState{
+                          k, eta,
+                          penetrabilityRatios[i], shiftFactorRatios[i],
+                          phaseShiftRatios[i], 0., 0., 0.,
+                          calculateCoulombPhaseShift< ChannelType >( l, eta ),
+                          this->belowThreshold( energy ) } );
+    }
+
+    calculateHardSphereFunctions( l, size, penetrabilityRatios,
+                                  shiftFactorRatios, phaseShiftRatios,
+                                  penetrability, shiftFactor, phaseShift );
+
+    for ( unsigned int i = 0; i < size; ++i ) {
+
+      auto& state = states[ offset + i ];
+      state.penetrability = penetrability[i];
+      state.shiftFactor = shiftFactor[i];
+      state.phaseShift = phaseShift[i];
+    }
+  }
+  else {
+
+    for ( unsigned int i = first; i < last; ++i ) {
+
+      states.push_back( this->state( energies[i] ) );
+    }
+  }
+}
@@ -0,0 +1,67 @@
+/**
+ *  @brief Tabulate the penetrability, shift factor and phase shift for this
+ *         channel over an energy interval
+ *
+ *  For charged particle channels with energy independent channel radii, the
+ *  penetrability, shift factor and phase shift are tabulated as a function of
+ *  the wave number (see CoulombFunctionTable) so that state() can interpolate
+ *  them instead of evaluating the Coulomb wave functions at every energy. The
+ *  table does not extend below 1e-3 times the largest wave number in the
+ *  interval (the wave number goes to zero at a threshold), for those wave
+ *  numbers the Coulomb functions are still evaluated directly.
+ *
+ *  For all other channels, this function does nothing. The table is shared
+ *  between copies of the channel.
+ *
+ *  @param[in] lower       the lower energy of the interval
+ *  @param[in] upper       the upper energy of the interval
+ *  @param[in] tolerance   the tolerance on the interpolated values (a
+ *                         relative tolerance on the penetrability)
+ */
+void tabulateCoulombFunctions( const Energy& lower, const Energy& upper,
+                               double tolerance ) {
+
+  if constexpr ( std::is_same_v< ChannelType, ChargedParticle > ) {
+
+    if ( not this->radii().isEnergyIndependent() ) {
+
+      return;
+    }
+
+    // the wave number interval
+    const auto klower = this->waveNumber( lower );
+    const auto kupper = this->waveNumber( upper );
+    const auto kmaximum = klower > kupper ? klower : kupper;
+    double kmin = this->belowThreshold( lower ) == this->belowThreshold( upper )
+                  ? std::min( klower.value, kupper.value ) : 0.;
+    kmin = std::max( kmin, 1e-3 * kmaximum.value );
+    const double kmax = kmaximum.value;
+    if ( not ( kmax > kmin ) ) {
+
+      return;
+    }
+
+    // eta is inversely proportional to the wave number
+    const double constant = this->sommerfeldParameter( kmaximum ) * kmax;
+    const double penetrabilityRadius =
+        this->radii().penetrabilityRadius( lower ).value;
+    const double shiftFactorRadius =
+        this->radii().shiftFactorRadius( lower ).value;
+    const double phaseShiftRadius =
+        this->radii().phaseShiftRadius( lower ).value;
+    const unsigned int l = this->quantumNumbers().orbitalAngularMomentum();
+
+    auto function = [&] ( double k ) {
+
+      std::array< double, 3 > values;
+      calculateWaveFunctionQuantities< ChargedParticle >(
+          l, k * penetrabilityRadius, k * shiftFactorRadius,
+          k * phaseShiftRadius, constant / k,
+          values[0], values[1], values[2] );
+      return values;
+    };
+
+    this->coulomb_ = std::make_shared< const CoulombFunctionTable >(
+                         function, kmin, kmax, tolerance );
+  }
+}
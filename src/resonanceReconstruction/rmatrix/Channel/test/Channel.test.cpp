@@ -323,6 +323,205 @@ SCENARIO( "Channel" ) {
       // other values calculated by hand
     } // THEN
 
+    THEN( "the state of a Channel can be calculated" ) {
+
+      Energy energy = 1e-5 * electronVolt;
+
+      Channel< ChargedParticle > protonEmission( elasticPair,
+                                                 protonEmissionPair,
+                                                 protonEmissionQ,
+                                                 protonEmissionNumbers,
+                                                 protonEmissionRadii );
+
+      auto state = protonEmission.state( energy );
+      CHECK( protonEmission.waveNumber( energy ).value ==
+             state.waveNumber.value );
+      CHECK( protonEmission.sommerfeldParameter( energy ) ==
+             state.sommerfeldParameter );
+      CHECK( 1.69828445E+00 * .4822220 ==
+             Approx( state.penetrabilityRatio ) );
+      CHECK( 1.69828445E+00 * .4822220 == Approx( state.shiftFactorRatio ) );
+      CHECK( 1.69828445E+00 * .3667980 == Approx( state.phaseShiftRatio ) );
+      CHECK( protonEmission.penetrability( energy ) == state.penetrability );
+      CHECK( protonEmission.shiftFactor( energy ) == state.shiftFactor );
+      CHECK( protonEmission.phaseShift( energy ) == state.phaseShift );
+      CHECK( protonEmission.coulombPhaseShift( energy ) ==
+             state.coulombPhaseShift );
+      CHECK( false == state.belowThreshold );
+
+      Channel< Neutron > inelastic( elasticPair, inelasticPair, inelasticQ,
+                                    inelasticNumbers, inelasticRadii );
+
+      state = inelastic.state( energy );
+      CHECK( 2.39164854E+00 == Approx( state.waveNumber.value ) );
+      CHECK( 0.0 == state.sommerfeldParameter );
+      CHECK( 2.39164854E+00 * .4822220 ==
+             Approx( state.penetrabilityRatio ) );
+      CHECK( 2.39164854E+00 * .4822220 == Approx( state.shiftFactorRatio ) );
+      CHECK( 2.39164854E+00 * .3667980 == Approx( state.phaseShiftRatio ) );
+      CHECK( inelastic.penetrability( energy ) == state.penetrability );
+      CHECK( inelastic.shiftFactor( energy ) == state.shiftFactor );
+      CHECK( inelastic.phaseShift( energy ) == state.phaseShift );
+      CHECK( inelastic.coulombPhaseShift( energy ) ==
+             state.coulombPhaseShift );
+      CHECK( true == state.belowThreshold );
+    } // THEN
+
+    THEN( "the states of a Channel can be calculated for a range of energies" ) {
+
+      std::vector< Energy > energies = {
+          1e-5 * electronVolt, 1e-2 * electronVolt, 1. * electronVolt,
+          1e+3 * electronVolt, 2.5e+5 * electronVolt, 1e+6 * electronVolt,
+          1.3e+6 * electronVolt, 5e+6 * electronVolt, 2e+7 * electronVolt };
+
+      Channel< Neutron > inelastic( elasticPair, inelasticPair, inelasticQ,
+                                    inelasticNumbers, inelasticRadii );
+      Channel< Neutron > dwave( elasticPair, elasticPair, elasticQ,
+                                ChannelQuantumNumbers( 2, 1.0, 1.0, +1 ),
+                                elasticRadii );
+      Channel< Neutron > fwave( elasticPair, elasticPair, elasticQ,
+                                ChannelQuantumNumbers( 3, 1.0, 1.0, +1 ),
+                                elasticRadii );
+      Channel< Neutron > hwave( elasticPair, elasticPair, elasticQ,
+                                ChannelQuantumNumbers( 5, 1.0, 1.0, +1 ),
+                                elasticRadii );
+      Channel< ChargedParticle > protonEmission( elasticPair,
+                                                 protonEmissionPair,
+                                                 protonEmissionQ,
+                                                 protonEmissionNumbers,
+                                                 protonEmissionRadii );
+
+      auto verify = [&] ( const auto& channel ) {
+
+        std::vector< ChannelState > states = { channel.state( energies[0] ) };
+        AlignedVector< double > scratch;
+        channel.states( energies, 1, energies.size(), states, scratch );
+        REQUIRE( energies.size() == states.size() );
+
+        for ( unsigned int i = 0; i < energies.size(); ++i ) {
+
+          auto state = channel.state( energies[i] );
+          CHECK( state.waveNumber.value == states[i].waveNumber.value );
+          CHECK( state.sommerfeldParameter == states[i].sommerfeldParameter );
+          CHECK( state.penetrabilityRatio == states[i].penetrabilityRatio );
+          CHECK( state.shiftFactorRatio == states[i].shiftFactorRatio );
+          CHECK( state.phaseShiftRatio == states[i].phaseShiftRatio );
+          CHECK( state.penetrability == states[i].penetrability );
+          CHECK( state.shiftFactor == states[i].shiftFactor );
+          CHECK( state.phaseShift == states[i].phaseShift );
+          CHECK( state.coulombPhaseShift == states[i].coulombPhaseShift );
+          CHECK( state.belowThreshold == states[i].belowThreshold );
+        }
+      };
+
+      verify( inelastic );
+      verify( dwave );
+      verify( fwave );
+      verify( hwave );
+      verify( protonEmission );
+    } // THEN
+
+    THEN( "the derivatives of a Channel can be calculated" ) {
+
+      Channel< Photon > capture( elasticPair, capturePair, captureQ,
+                                 captureNumbers, captureRadii );
+      Channel< Neutron > inelastic( elasticPair, inelasticPair, inelasticQ,
+                                    inelasticNumbers, inelasticRadii );
+      Channel< Neutron > pwave( elasticPair, elasticPair, elasticQ,
+                                ChannelQuantumNumbers( 1, 1.0, 1.0, -1 ),
+                                elasticRadii );
+      Channel< Neutron > fwave( elasticPair, elasticPair, elasticQ,
+                                ChannelQuantumNumbers( 3, 1.0, 1.0, -1 ),
+                                elasticRadii );
+      Channel< ChargedParticle > protonEmission( elasticPair,
+                                                 protonEmissionPair,
+                                                 protonEmissionQ,
+                                                 protonEmissionNumbers,
+                                                 protonEmissionRadii );
+
+      CHECK( true == capture.hasDerivatives() );
+      CHECK( true == inelastic.hasDerivatives() );
+      CHECK( false == protonEmission.hasDerivatives() );
+      CHECK_THROWS( protonEmission.derivatives( 1e+3 * electronVolt ) );
+
+      auto derivatives = capture.derivatives( 1e+3 * electronVolt );
+      CHECK( 0. == derivatives[0] );
+      CHECK( 0. == derivatives[1] );
+      CHECK( 0. == derivatives[2] );
+
+      // compare with a central finite difference
+      auto verify = [&] ( const auto& channel, double energy ) {
+
+        const double h = 1e-6 * energy;
+        const Energy upper = ( energy + h ) * electronVolt;
+        const Energy lower = ( energy - h ) * electronVolt;
+        const auto derivatives = channel.derivatives( energy * electronVolt );
+        CHECK( ( channel.penetrability( upper ) -
+                 channel.penetrability( lower ) ) / ( 2. * h ) ==
+               Approx( derivatives[0] ).epsilon( 1e-5 ) );
+        CHECK( ( channel.shiftFactor( upper ) -
+                 channel.shiftFactor( lower ) ) / ( 2. * h ) ==
+               Approx( derivatives[1] ).epsilon( 1e-5 ) );
+        CHECK( ( channel.phaseShift( upper ) -
+                 channel.phaseShift( lower ) ) / ( 2. * h ) ==
+               Approx( derivatives[2] ).epsilon( 1e-5 ) );
+      };
+
+      // at low energies, the phase shift for l > 0 suffers from cancellation
+      for ( double energy : { 1e+3, 2.5e+5, 5e+6 } ) {
+
+        verify( pwave, energy );
+      }
+      for ( double energy : { 1e+6, 5e+6, 2e+7 } ) {
+
+        verify( fwave, energy );
+      }
+      for ( double energy : { 1.3e+6, 5e+6, 2e+7 } ) {
+
+        verify( inelastic, energy );
+      }
+    } // THEN
+
+    THEN( "the Coulomb functions of a Channel can be tabulated" ) {
+
+      Channel< ChargedParticle > protonEmission( elasticPair,
+                                                 protonEmissionPair,
+                                                 protonEmissionQ,
+                                                 protonEmissionNumbers,
+                                                 protonEmissionRadii );
+      Channel< ChargedParticle > reference = protonEmission;
+
+      CHECK( false == protonEmission.isTabulated() );
+      protonEmission.tabulateCoulombFunctions( 1e-5 * electronVolt,
+                                               1e+6 * electronVolt, 1e-7 );
+      CHECK( true == protonEmission.isTabulated() );
+      CHECK( false == reference.isTabulated() );
+
+      for ( auto energy : { 1e-5 * electronVolt, 1. * electronVolt,
+                            1e+3 * electronVolt, 2.5e+5 * electronVolt,
+                            1e+6 * electronVolt } ) {
+
+        auto tabulated = protonEmission.state( energy );
+        auto direct = reference.state( energy );
+        CHECK( direct.waveNumber.value == tabulated.waveNumber.value );
+        CHECK( direct.sommerfeldParameter == tabulated.sommerfeldParameter );
+        CHECK( direct.penetrability ==
+               Approx( tabulated.penetrability ).epsilon( 1e-6 ) );
+        CHECK( direct.shiftFactor ==
+               Approx( tabulated.shiftFactor ).epsilon( 1e-6 ) );
+        CHECK( direct.phaseShift ==
+               Approx( tabulated.phaseShift ).epsilon( 1e-6 ) );
+        CHECK( direct.coulombPhaseShift == tabulated.coulombPhaseShift );
+      }
+
+      // a neutron channel is never tabulated
+      Channel< Neutron > inelastic( elasticPair, inelasticPair, inelasticQ,
+                                    inelasticNumbers, inelasticRadii );
+      inelastic.tabulateCoulombFunctions( 1e-5 * electronVolt,
+                                          1e+6 * electronVolt, 1e-7 );
+      CHECK( false == inelastic.isTabulated() );
+    } // THEN
+
     THEN( "a Channel can be constructed with an alternate ParticleID" ) {
 
       Energy energy = 1e-5 * electronVolt;
@@ -26,6 +26,19 @@ public:
   /* constructor */
   #include "resonanceReconstruction/rmatrix/ChannelRadii/src/ctor.hpp"
 
+  /**
+   *  @brief Return whether or not all channel radii are energy independent
+   */
+  bool isEnergyIndependent() const {
+
+    auto independent = [] ( const ChannelRadiusVariant& radius )
+                          { return std::holds_alternative< ChannelRadius >(
+                                       radius ); };
+    return independent( this->penetrability_ ) and
+           independent( this->shiftFactor_ ) and
+           independent( this->phaseShift_ );
+  }
+
   /**
    *  @brief Return the channel radius for the penetrability P
    *
@@ -2,20 +2,71 @@
  *  @class
  *  @brief Energy dependent channel radius table
  *
- *  This class contains a shared pointer to a MultiRegionTable because the
+ *  This class contains a shared pointer to the table data because the
  *  energy dependent scattering radius can be shared by multiple channels. ENDF
  *  only defines one energy dependent channel radius which is then used in all
  *  lJ spin groups for SLBW, MLBW, RM resolved resonances and unresolved
  *  resonances. GNDS is more broader than this and allows for energy dependent
  *  channel radii to be defined up to the spin group level.
+ *
+ *  The table consists of one or more interpolation regions using the ENDF
+ *  interpolation laws (histogram, lin-lin, lin-log, log-lin and log-log). The
+ *  regions are stored as a single grid with an interpolation law for every
+ *  interval.
+ *
+ *  Every thread keeps a cursor for each table holding the index of the last
+ *  interval that was used, together with the last energy and radius. Since
+ *  all channels sharing the table request the radius at the same energy
+ *  (usually several times for the penetrability, shift factor and phase shift
+ *  radii), the table is only interpolated once for every energy on a given
+ *  thread. For a new energy, the interval is found by hunting outwards from
+ *  the interval in the cursor so that the search is O(1) amortised when
+ *  energies are processed in increasing (or decreasing) order.
+ *
+ *  The cursors of a thread are indexed by a slot assigned to each table,
+ *  slots are reused once a table (and all of its copies) no longer exists so
+ *  that the number of cursors is limited to the number of live tables. The
+ *  cursor also stores a unique table identifier so that a cursor left behind
+ *  by a previous owner of the slot is never used.
  */
 class ChannelRadiusTable {
 
-  /* aliases */
-  using RadiusTable = MultiRegionTable< Energy, ChannelRadius >;
+  /* type aliases */
+  struct Cursor {
+
+    std::size_t identifier = 0;
+    unsigned int interval = 0;
+    double energy = std::numeric_limits< double >::quiet_NaN();
+    ChannelRadius radius = 0. * rootBarn;
+  };
+
+  struct Slots {
+
+    std::mutex mutex;
+    std::vector< std::size_t > available;
+    std::size_t size = 0;
+  };
+
+  struct Data {
+
+    std::vector< double > energies;
+    std::vector< double > radii;
+    std::vector< int > interpolants;
+    std::size_t identifier;
+    std::size_t slot;
+
+    ~Data() { releaseSlot( this->slot ); }
+  };
 
   /* fields */
-  std::shared_ptr< RadiusTable > table_;
+  std::shared_ptr< const Data > data_;
+
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/ChannelRadiusTable/src/makeIdentifier.hpp"
+  #include "resonanceReconstruction/rmatrix/ChannelRadiusTable/src/slots.hpp"
+  #include "resonanceReconstruction/rmatrix/ChannelRadiusTable/src/makeData.hpp"
+  #include "resonanceReconstruction/rmatrix/ChannelRadiusTable/src/interval.hpp"
+  #include "resonanceReconstruction/rmatrix/ChannelRadiusTable/src/interpolate.hpp"
 
 public:
 
@@ -29,6 +80,27 @@ public:
    */
   ChannelRadius operator()( const Energy& energy ) const {
 
-    return this->table_->operator()( energy );
+    thread_local std::vector< Cursor > cursors;
+    const Data& data = *this->data_;
+    if ( cursors.size() <= data.slot ) {
+
+      cursors.resize( data.slot + 1 );
+    }
+
+    Cursor& cursor = cursors[ data.slot ];
+    if ( cursor.identifier != data.identifier ) {
+
+      cursor = Cursor{};
+      cursor.identifier = data.identifier;
+    }
+
+    if ( cursor.energy != energy.value ) {
+
+      cursor.interval = this->interval( energy.value, cursor.interval );
+      cursor.radius = this->interpolate( energy.value, cursor.interval )
+                      * rootBarn;
+      cursor.energy = energy.value;
+    }
+    return cursor.radius;
   }
 };
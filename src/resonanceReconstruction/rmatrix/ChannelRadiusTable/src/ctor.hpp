@@ -1,10 +1,20 @@
 /**
  *  @brief Constructor
  *
- *  @param[in] table   the energy dependent channel radius
+ *  The table is given as a number of interpolation regions, each with their
+ *  own energies, radii and ENDF interpolation law (1 = histogram, 2 =
+ *  lin-lin, 3 = lin-log, 4 = log-lin and 5 = log-log). Consecutive regions
+ *  share their boundary point, as given by the regions of the ENDF scattering
+ *  radius.
+ *
+ *  @param[in] energies       the energy values of each region
+ *  @param[in] radii          the radius values of each region
+ *  @param[in] interpolants   the ENDF interpolation law of each region
  */
- ChannelRadiusTable( RadiusTable&& table ) :
-   table_( std::make_shared< RadiusTable >( std::move( table ) ) ) {}
+ChannelRadiusTable( const std::vector< std::vector< Energy > >& energies,
+                    const std::vector< std::vector< ChannelRadius > >& radii,
+                    const std::vector< int >& interpolants ) :
+  data_( makeData( energies, radii, interpolants ) ) {}
 
 /**
  *  @brief Default copy constructor
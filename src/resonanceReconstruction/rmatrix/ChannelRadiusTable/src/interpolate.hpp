@@ -0,0 +1,36 @@
+/**
+ *  @brief Interpolate the radius in the given interval
+ *
+ *  The ENDF interpolation law of the interval is used. On a grid point, the
+ *  radius at that point is returned. When the grid point is repeated (a
+ *  discontinuity), the radius at its first occurrence is used.
+ *
+ *  @param[in] energy     the energy value (in eV)
+ *  @param[in] interval   the interval containing the energy
+ */
+double interpolate( const double energy, const unsigned int interval ) const {
+
+  const auto& x = this->data_->energies;
+  const auto& y = this->data_->radii;
+  const unsigned int i = interval;
+
+  if ( energy == x[i] ) {
+
+    return ( ( i > 0 ) and ( x[ i - 1 ] == energy ) ) ? y[ i - 1 ] : y[i];
+  }
+
+  switch ( this->data_->interpolants[i] ) {
+
+    case 1 : return y[i];
+    case 2 : return y[i] + ( y[ i + 1 ] - y[i] ) * ( energy - x[i] )
+                           / ( x[ i + 1 ] - x[i] );
+    case 3 : return y[i] + ( y[ i + 1 ] - y[i] ) * std::log( energy / x[i] )
+                           / std::log( x[ i + 1 ] / x[i] );
+    case 4 : return y[i] * std::exp( std::log( y[ i + 1 ] / y[i] )
+                                     * ( energy - x[i] )
+                                     / ( x[ i + 1 ] - x[i] ) );
+    default : return y[i] * std::exp( std::log( y[ i + 1 ] / y[i] )
+                                      * std::log( energy / x[i] )
+                                      / std::log( x[ i + 1 ] / x[i] ) );
+  }
+}
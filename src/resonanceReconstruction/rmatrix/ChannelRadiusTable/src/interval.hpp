@@ -0,0 +1,57 @@
+/**
+ *  @brief Return the index of the interval containing the given energy
+ *
+ *  The interval i satisfies x[i] <= energy < x[i+1] (the last interval is
+ *  used for the last energy in the table). Starting from the given interval,
+ *  the search steps outwards using increasing steps until the energy is
+ *  bracketed, after which a binary search is performed within the bracket.
+ *  When the energy is in the same or a neighbouring interval, only a few
+ *  comparisons are required.
+ *
+ *  @param[in] energy   the energy value (in eV)
+ *  @param[in] hint     the interval from which to start the search
+ */
+unsigned int interval( const double energy, const unsigned int hint ) const {
+
+  const auto& x = this->data_->energies;
+  const unsigned int last = x.size() - 1;
+
+  if ( ( energy < x.front() ) or ( energy > x.back() ) ) {
+
+    Log::error( "The energy is outside of the channel radius table" );
+    Log::info( "Requested {} eV, the table covers [{}, {}] eV",
+               energy, x.front(), x.back() );
+    throw std::exception();
+  }
+
+  // bracket the energy: x[lower] <= energy and x[upper] > energy (unless
+  // upper is the last point)
+  unsigned int lower = std::min( hint, last - 1 );
+  unsigned int upper = lower + 1;
+  unsigned int step = 1;
+  if ( x[ lower ] <= energy ) {
+
+    while ( ( upper < last ) and ( x[ upper ] <= energy ) ) {
+
+      lower = upper;
+      upper = std::min( last, upper + step );
+      step *= 2;
+    }
+  }
+  else {
+
+    upper = lower;
+    while ( x[ lower ] > energy ) {
+
+      upper = lower;
+      lower = lower > step ? lower - step : 0;
+      step *= 2;
+    }
+  }
+
+  // the last point in [lower, upper) that is not larger than the energy
+  const unsigned int index =
+    std::upper_bound( x.begin() + lower, x.begin() + upper, energy )
+    - x.begin() - 1;
+  return std::min( index, last - 1 );
+}
@@ -0,0 +1,79 @@
+/**
+ *  @brief Verify the interpolation regions and store them as a single grid
+ *
+ *  The first point of a region is dropped when it is identical to the last
+ *  point of the previous region so that every interval in the grid belongs to
+ *  a single region.
+ *
+ *  @param[in] energies       the energy values of each region
+ *  @param[in] radii          the radius values of each region
+ *  @param[in] interpolants   the ENDF interpolation law of each region
+ */
+static std::shared_ptr< const Data >
+makeData( const std::vector< std::vector< Energy > >& energies,
+          const std::vector< std::vector< ChannelRadius > >& radii,
+          const std::vector< int >& interpolants ) {
+
+  if ( ( energies.size() == 0 ) or
+       ( energies.size() != radii.size() ) or
+       ( energies.size() != interpolants.size() ) ) {
+
+    Log::error( "The number of interpolation regions for the channel radius "
+                "table is inconsistent" );
+    Log::info( "Found {} energy regions, {} radius regions and {} "
+               "interpolation laws",
+               energies.size(), radii.size(), interpolants.size() );
+    throw std::exception();
+  }
+
+  auto data = std::make_shared< Data >();
+  data->identifier = makeIdentifier();
+  data->slot = acquireSlot();
+  for ( unsigned int r = 0; r < energies.size(); ++r ) {
+
+    const auto& x = energies[r];
+    const auto& y = radii[r];
+    const int interpolant = interpolants[r];
+    if ( ( x.size() < 2 ) or ( x.size() != y.size() ) ) {
+
+      Log::error( "The channel radius table region must have at least two "
+                  "points and the same number of energies and radii" );
+      Log::info( "Found {} energies and {} radii in region {}",
+                 x.size(), y.size(), r );
+      throw std::exception();
+    }
+    if ( ( interpolant < 1 ) or ( interpolant > 5 ) ) {
+
+      Log::error( "The channel radius table only supports the ENDF "
+                  "interpolation laws 1 to 5" );
+      Log::info( "Found interpolation law {} in region {}", interpolant, r );
+      throw std::exception();
+    }
+
+    unsigned int first = 0;
+    if ( data->energies.size() and
+         ( data->energies.back() == x.front().value ) and
+         ( data->radii.back() == y.front().value ) ) {
+
+      first = 1;
+    }
+    for ( unsigned int i = first; i < x.size(); ++i ) {
+
+      if ( data->energies.size() and ( x[i].value < data->energies.back() ) ) {
+
+        Log::error( "The energies in the channel radius table must be sorted" );
+        Log::info( "Found {} eV after {} eV in region {}",
+                   x[i].value, data->energies.back(), r );
+        throw std::exception();
+      }
+      if ( data->energies.size() ) {
+
+        data->interpolants.push_back( interpolant );
+      }
+      data->energies.push_back( x[i].value );
+      data->radii.push_back( y[i].value );
+    }
+  }
+
+  return data;
+}
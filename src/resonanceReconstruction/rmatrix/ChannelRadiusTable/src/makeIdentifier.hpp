@@ -0,0 +1,11 @@
+/**
+ *  @brief Return a new unique identifier for a table
+ *
+ *  Copies of a ChannelRadiusTable share the table data and its identifier.
+ *  The identifier 0 is never used so that it can mark an empty cursor.
+ */
+static std::size_t makeIdentifier() {
+
+  static std::atomic< std::size_t > counter( 0 );
+  return ++counter;
+}
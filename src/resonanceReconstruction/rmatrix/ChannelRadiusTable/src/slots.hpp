@@ -0,0 +1,37 @@
+/**
+ *  @brief Return the slots assigned to the tables
+ */
+static Slots& slots() {
+
+  static Slots instance;
+  return instance;
+}
+
+/**
+ *  @brief Return a slot for a new table, reusing a released slot if possible
+ */
+static std::size_t acquireSlot() {
+
+  Slots& slots = ChannelRadiusTable::slots();
+  std::lock_guard< std::mutex > lock( slots.mutex );
+  if ( slots.available.empty() ) {
+
+    return slots.size++;
+  }
+
+  const std::size_t slot = slots.available.back();
+  slots.available.pop_back();
+  return slot;
+}
+
+/**
+ *  @brief Release the slot of a table that no longer exists
+ *
+ *  @param[in] slot   the slot to be released
+ */
+static void releaseSlot( std::size_t slot ) {
+
+  Slots& slots = ChannelRadiusTable::slots();
+  std::lock_guard< std::mutex > lock( slots.mutex );
+  slots.available.push_back( slot );
+}
@@ -6,35 +6,30 @@
 using namespace njoy::resonanceReconstruction;
 
 // convenience typedefs
-using RadiusTable = rmatrix::MultiRegionTable< Energy, ChannelRadius >;
-using HistogramTable = rmatrix::HistogramTable< Energy, ChannelRadius >;
-using LinLinTable = rmatrix::LinLinTable< Energy, ChannelRadius >;
-using LinLogTable = rmatrix::LinLogTable< Energy, ChannelRadius >;
-using LogLinTable = rmatrix::LogLinTable< Energy, ChannelRadius >;
-using LogLogTable = rmatrix::LogLogTable< Energy, ChannelRadius >;
-using TableVariant = rmatrix::TableVariant< Energy, ChannelRadius >;
 using ChannelRadiusTable = rmatrix::ChannelRadiusTable;
 
 SCENARIO( "ChannelRadiusTable" ) {
 
   GIVEN( "valid data for a ChannelRadiusTable" ) {
 
-    std::vector< Energy > energies = { 1e-5 * electronVolt, 2e+7 * electronVolt };
-    std::vector< ChannelRadius > radii = { .5 * rootBarn, 1.0 * rootBarn };
-    RadiusTable singletable( std::vector< TableVariant >{
-                   LinLinTable( std::move( energies ), std::move( radii ) ) } );
+    std::vector< std::vector< Energy > > singleEnergies = {
+        { 1e-5 * electronVolt, 2e+7 * electronVolt } };
+    std::vector< std::vector< ChannelRadius > > singleRadii = {
+        { .5 * rootBarn, 1.0 * rootBarn } };
+    std::vector< int > singleInterpolants = { 2 };
 
-    std::vector< Energy > energies1 = { 1e-5 * electronVolt, 1.0 * electronVolt };
-    std::vector< Energy > energies2 = { 1. * electronVolt, 2e+7 * electronVolt };
-    std::vector< ChannelRadius > radii1 = { .5 * rootBarn, 1.0 * rootBarn };
-    std::vector< ChannelRadius > radii2 = { 1. * rootBarn, 1. * rootBarn };
-    RadiusTable multitable( std::vector< TableVariant >{
-                   LinLinTable( std::move( energies1 ), std::move( radii1 ) ),
-                   HistogramTable( std::move( energies2 ), std::move( radii2 ) ) } );
+    std::vector< std::vector< Energy > > multiEnergies = {
+        { 1e-5 * electronVolt, 1.0 * electronVolt },
+        { 1. * electronVolt, 2e+7 * electronVolt } };
+    std::vector< std::vector< ChannelRadius > > multiRadii = {
+        { .5 * rootBarn, 1.0 * rootBarn },
+        { 1. * rootBarn, 1. * rootBarn } };
+    std::vector< int > multiInterpolants = { 2, 1 };
 
     THEN( "a ChannelRadiusTable can be constructed for a single region" ) {
 
-      ChannelRadiusTable radius( std::move( singletable ) );
+      ChannelRadiusTable radius( singleEnergies, singleRadii,
+                                 singleInterpolants );
 
       CHECK( .5 == Approx( radius( 1e-5 * electronVolt ).value ) );
       CHECK( 5.000000000025E-01 == Approx( radius( 1e-4 * electronVolt ).value ) );
@@ -54,7 +49,8 @@ SCENARIO( "ChannelRadiusTable" ) {
 
     THEN( "a ChannelRadiusTable can be constructed for multiple regions" ) {
 
-      ChannelRadiusTable radius( std::move( multitable ) );
+      ChannelRadiusTable radius( multiEnergies, multiRadii,
+                                 multiInterpolants );
 
       CHECK( .5 == Approx( radius( 1e-5 * electronVolt ).value ) );
       CHECK( 5.00045000450E-01 == Approx( radius( 1e-4 * electronVolt ).value ) );
@@ -71,5 +67,192 @@ SCENARIO( "ChannelRadiusTable" ) {
       CHECK( 1. == Approx( radius( 1e+7 * electronVolt ).value ) );
       CHECK( 1. == Approx( radius( 2e+7 * electronVolt ).value ) );
     } // THEN
+
+    THEN( "ChannelRadiusTable instances can be used in any order" ) {
+
+      ChannelRadiusTable single( singleEnergies, singleRadii,
+                                 singleInterpolants );
+      ChannelRadiusTable multi( multiEnergies, multiRadii, multiInterpolants );
+      ChannelRadiusTable copy = single;
+
+      // alternate between tables sharing an energy
+      for ( auto energy : { 1e-2 * electronVolt, 1e-2 * electronVolt,
+                            1e-3 * electronVolt, 1e+6 * electronVolt } ) {
+
+        const double reference = single( energy ).value;
+        CHECK( reference == copy( energy ).value );
+        CHECK( reference == single( energy ).value );
+        CHECK( reference != multi( energy ).value );
+        CHECK( reference == copy( energy ).value );
+      }
+
+      CHECK( 5.000000002500E-01 == Approx( copy( 1e-2 * electronVolt ).value ) );
+      CHECK( 5.04995049950E-01 == Approx( multi( 1e-2 * electronVolt ).value ) );
+      CHECK( 5.000000002500E-01 == Approx( single( 1e-2 * electronVolt ).value ) );
+    } // THEN
+
+    THEN( "ChannelRadiusTable instances can be used in any order when there are "
+          "many tables" ) {
+
+      // 20 tables with radius ( i + 1 ) * ( 0.5 + 0.025 * energy / 1 MeV )
+      std::vector< ChannelRadiusTable > tables;
+      for ( unsigned int i = 0; i < 20; ++i ) {
+
+        tables.emplace_back(
+            std::vector< std::vector< Energy > >{
+                { 0. * electronVolt, 2e+7 * electronVolt } },
+            std::vector< std::vector< ChannelRadius > >{
+                { ( i + 1 ) * 0.5 * rootBarn, ( i + 1 ) * 1.0 * rootBarn } },
+            std::vector< int >{ 2 } );
+      }
+
+      for ( auto energy : { 1e+6 * electronVolt, 1e+6 * electronVolt,
+                            1e+7 * electronVolt } ) {
+
+        for ( unsigned int repeat = 0; repeat < 2; ++repeat ) {
+
+          for ( unsigned int i = 0; i < tables.size(); ++i ) {
+
+            CHECK( ( i + 1 ) * ( 0.5 + 0.025 * energy.value / 1e+6 ) ==
+                   Approx( tables[i]( energy ).value ) );
+          }
+        }
+      }
+    } // THEN
+
+    THEN( "tables created after others were destroyed do not reuse their "
+          "values" ) {
+
+      for ( unsigned int i = 0; i < 5; ++i ) {
+
+        ChannelRadiusTable table(
+            std::vector< std::vector< Energy > >{
+                { 0. * electronVolt, 2e+7 * electronVolt } },
+            std::vector< std::vector< ChannelRadius > >{
+                { ( i + 1 ) * 0.5 * rootBarn, ( i + 1 ) * 0.5 * rootBarn } },
+            std::vector< int >{ 2 } );
+        CHECK( ( i + 1 ) * 0.5 == Approx( table( 1e+6 * electronVolt ).value ) );
+      }
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "a ChannelRadiusTable using all interpolation laws" ) {
+
+    ChannelRadiusTable table(
+        std::vector< std::vector< Energy > >{
+            { 1. * electronVolt, 2. * electronVolt, 3. * electronVolt },
+            { 3. * electronVolt, 4. * electronVolt, 5. * electronVolt },
+            { 5. * electronVolt, 10. * electronVolt, 20. * electronVolt },
+            { 20. * electronVolt, 30. * electronVolt, 40. * electronVolt },
+            { 40. * electronVolt, 100. * electronVolt, 1000. * electronVolt } },
+        std::vector< std::vector< ChannelRadius > >{
+            { 1. * rootBarn, 2. * rootBarn, 3. * rootBarn },
+            { 3. * rootBarn, 5. * rootBarn, 4. * rootBarn },
+            { 4. * rootBarn, 5. * rootBarn, 6. * rootBarn },
+            { 6. * rootBarn, 8. * rootBarn, 7. * rootBarn },
+            { 7. * rootBarn, 9. * rootBarn, 8. * rootBarn } },
+        std::vector< int >{ 1, 2, 3, 4, 5 } );
+
+    auto reference = [] ( double e ) {
+
+      if ( e < 3. ) {
+
+        return e < 2. ? 1. : 2.;
+      }
+      if ( e <= 5. ) {
+
+        return e < 4. ? 3. + 2. * ( e - 3. ) : 5. - ( e - 4. );
+      }
+      if ( e <= 20. ) {
+
+        return e < 10. ? 4. + std::log( e / 5. ) / std::log( 2. )
+                       : 5. + std::log( e / 10. ) / std::log( 2. );
+      }
+      if ( e <= 40. ) {
+
+        return e < 30. ? 6. * std::exp( std::log( 8. / 6. ) * ( e - 20. ) / 10. )
+                       : 8. * std::exp( std::log( 7. / 8. ) * ( e - 30. ) / 10. );
+      }
+      return e < 100.
+             ? 7. * std::exp( std::log( 9. / 7. ) * std::log( e / 40. )
+                              / std::log( 100. / 40. ) )
+             : 9. * std::exp( std::log( 8. / 9. ) * std::log( e / 100. )
+                              / std::log( 10. ) );
+    };
+
+    // energies between 1 and 1000 eV, including the grid points
+    std::vector< double > energies;
+    for ( unsigned int i = 0; i < 200; ++i ) {
+
+      energies.push_back( std::pow( 1000., i / 199. ) );
+    }
+    energies.front() = 1.;
+    energies.back() = 1000.;
+    for ( double e : { 2., 3., 4., 5., 10., 20., 30., 40., 100. } ) {
+
+      energies.push_back( e );
+    }
+    std::sort( energies.begin(), energies.end() );
+
+    THEN( "the radius can be evaluated for increasing energies" ) {
+
+      for ( double e : energies ) {
+
+        CHECK( reference( e ) == Approx( table( e * electronVolt ).value ) );
+      }
+    } // THEN
+
+    THEN( "the radius can be evaluated for decreasing energies" ) {
+
+      for ( auto e = energies.rbegin(); e != energies.rend(); ++e ) {
+
+        CHECK( reference( *e ) == Approx( table( *e * electronVolt ).value ) );
+      }
+    } // THEN
+
+    THEN( "the radius can be evaluated for energies in any order" ) {
+
+      const std::size_t size = energies.size();
+      for ( std::size_t i = 0; i < size; ++i ) {
+
+        const double e = energies[ ( i * 89 ) % size ];
+        CHECK( reference( e ) == Approx( table( e * electronVolt ).value ) );
+      }
+    } // THEN
+
+    THEN( "an exception is thrown for energies outside of the table" ) {
+
+      CHECK_THROWS( table( 0.5 * electronVolt ) );
+      CHECK_THROWS( table( 1001. * electronVolt ) );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "invalid data for a ChannelRadiusTable" ) {
+
+    THEN( "an exception is thrown" ) {
+
+      // inconsistent number of regions
+      CHECK_THROWS( ChannelRadiusTable(
+          std::vector< std::vector< Energy > >{
+              { 1. * electronVolt, 2. * electronVolt } },
+          std::vector< std::vector< ChannelRadius > >{},
+          std::vector< int >{ 2 } ) );
+
+      // unsupported interpolation law
+      CHECK_THROWS( ChannelRadiusTable(
+          std::vector< std::vector< Energy > >{
+              { 1. * electronVolt, 2. * electronVolt } },
+          std::vector< std::vector< ChannelRadius > >{
+              { 1. * rootBarn, 2. * rootBarn } },
+          std::vector< int >{ 6 } ) );
+
+      // unsorted energies
+      CHECK_THROWS( ChannelRadiusTable(
+          std::vector< std::vector< Energy > >{
+              { 2. * electronVolt, 1. * electronVolt } },
+          std::vector< std::vector< ChannelRadius > >{
+              { 1. * rootBarn, 2. * rootBarn } },
+          std::vector< int >{ 2 } ) );
+    } // THEN
   } // GIVEN
 } // SCENARIO
@@ -0,0 +1,31 @@
+/**
+ *  @class
+ *  @brief The energy dependent quantities of a channel at a given energy
+ *
+ *  A channel state contains the wave number k, the Sommerfeld parameter eta,
+ *  the values rho = k * a for each channel radius a and the resulting
+ *  penetrability P, shift factor S, phase shift phi and coulomb phase shift
+ *  omega of a channel at a given energy.
+ *
+ *  Calculating these once for every channel at the start of the evaluation of
+ *  a spin group and sharing them with all calculations that require them
+ *  avoids calculating the wave number and the wave functions (a Coulomb
+ *  function evaluation for charged particle channels) more than once at the
+ *  same energy.
+ *
+ *  A channel state is obtained using the state() function of a Channel.
+ */
+struct ChannelState {
+
+  /* fields */
+  WaveNumber waveNumber;
+  double sommerfeldParameter;
+  double penetrabilityRatio;
+  double shiftFactorRatio;
+  double phaseShiftRatio;
+  double penetrability;
+  double shiftFactor;
+  double phaseShift;
+  double coulombPhaseShift;
+  bool belowThreshold;
+};
@@ -7,10 +7,13 @@ class CompoundSystem {
 
   /* fields */
   std::vector< SpinGroup< Formalism, BoundaryOption > > groups_;
+  ReactionIndex index_;
 
   /* auxiliary functions */
   #include "resonanceReconstruction/rmatrix/CompoundSystem/src/makeSpinGroups.hpp"
   #include "resonanceReconstruction/rmatrix/CompoundSystem/src/verifySpinGroups.hpp"
+  #include "resonanceReconstruction/rmatrix/CompoundSystem/src/makeReactionIndex.hpp"
+  #include "resonanceReconstruction/rmatrix/CompoundSystem/src/fill.hpp"
 
 public:
 
@@ -19,7 +22,31 @@ public:
 
   auto spinGroups() const { return ranges::view::all( this->groups_ ); }
 
+  /**
+   *  @brief Return the reaction index
+   *
+   *  The reaction index gives the reaction identifier associated to each slot
+   *  of the dense cross section array used in evaluate().
+   */
+  const ReactionIndex& reactionIndex() const { return this->index_; }
+
+  /**
+   *  @brief Return whether or not the cross section derivatives can be
+   *         calculated
+   *
+   *  The derivatives are available when all spin groups can calculate them
+   *  (see SpinGroup::hasDerivatives()).
+   */
+  bool hasDerivatives() const {
+
+    return std::all_of( this->groups_.begin(), this->groups_.end(),
+                        [] ( const auto& group )
+                           { return group.hasDerivatives(); } );
+  }
+
   //#include "resonanceReconstruction/rmatrix/CompoundSystem/src/switchIncidentPair.hpp"
+  #include "resonanceReconstruction/rmatrix/CompoundSystem/src/tabulateCoulombFunctions.hpp"
+  #include "resonanceReconstruction/rmatrix/CompoundSystem/src/workspace.hpp"
   #include "resonanceReconstruction/rmatrix/CompoundSystem/src/evaluate.hpp"
   #include "resonanceReconstruction/rmatrix/CompoundSystem/src/evaluateTMatrix.hpp"
   #include "resonanceReconstruction/rmatrix/CompoundSystem/src/grid.hpp"
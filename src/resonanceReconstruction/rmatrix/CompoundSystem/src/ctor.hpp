@@ -7,6 +7,7 @@ CompoundSystem( std::vector< SpinGroup< Formalism, BoundaryOption > >&& groups )
   groups_( std::move( groups ) ) {
 
   verifySpinGroups( this->groups_ );
+  this->index_ = makeReactionIndex( this->groups_ );
 }
 
 /**
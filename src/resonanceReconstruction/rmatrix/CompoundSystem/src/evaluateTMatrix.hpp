@@ -1,14 +1,35 @@
 /**
  *  @brief Evaluate the elements of the T or X matrix at the given energy
  *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the matrix elements
+ *  @param[in,out] workspace   the evaluation workspace (obtained through the
+ *                             workspace() function)
+ */
+void evaluateTMatrix(
+         const Energy& energy,
+         std::map< ReactionChannelID, std::complex< double > >& result,
+         EvaluationWorkspace& workspace ) const {
+
+  for ( unsigned int i = 0; i < this->groups_.size(); ++i ) {
+
+    this->groups_[i].evaluateTMatrix( energy, result,
+                                      workspace.spinGroup( i ) );
+  }
+}
+
+/**
+ *  @brief Evaluate the elements of the T or X matrix at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
  *  @param[in] energy       the incident energy
  *  @param[in,out] result   a map containing the matrix elements
  */
 void evaluateTMatrix(
          const Energy& energy,
-         std::map< ReactionChannelID, std::complex< double > >& result ) {
+         std::map< ReactionChannelID, std::complex< double > >& result ) const {
 
-  ranges::for_each( this->groups_,
-                    [&] ( auto& group )
-                        { group.evaluateTMatrix( energy, result ); } );
+  auto workspace = this->workspace();
+  this->evaluateTMatrix( energy, result, workspace );
 }
@@ -0,0 +1,50 @@
+/**
+ *  @brief Evaluate the cross sections for a range of energies and store them
+ *         in the given columns
+ *
+ *  The energies are processed in tiles. Within a tile, each spin group is
+ *  evaluated for every energy in the tile before moving on to the next spin
+ *  group so that the data of a spin group remains in cache. This also allows
+ *  the channel states of a spin group to be calculated for all energies in
+ *  the tile at once.
+ *
+ *  Only the values in [begin, end) of each column are written so that
+ *  disjoint ranges can be filled concurrently.
+ *
+ *  @param[in] energies        the energy grid
+ *  @param[in] columns         the cross section values for each slot
+ *  @param[in] begin           the index of the first energy to be evaluated
+ *  @param[in] end             the index past the last energy to be evaluated
+ *  @param[in,out] workspace   the evaluation workspace
+ */
+template < typename Energies >
+void fill( const Energies& energies, const std::vector< double* >& columns,
+           unsigned int begin, unsigned int end,
+           EvaluationWorkspace& workspace ) const {
+
+  const unsigned int size = columns.size();
+  std::vector< std::vector< double > >
+      results( CrossSectionTable::tileSize, std::vector< double >( size ) );
+  for ( unsigned int first = begin; first < end;
+        first += CrossSectionTable::tileSize ) {
+
+    const unsigned int last =
+        std::min( first + CrossSectionTable::tileSize, end );
+
+    for ( unsigned int g = 0; g < this->groups_.size(); ++g ) {
+
+      this->groups_[g].evaluate( energies, first, last, results,
+                                 workspace.spinGroup( g ) );
+    }
+
+    for ( unsigned int i = first; i < last; ++i ) {
+
+      auto& result = results[ i - first ];
+      for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+        columns[ slot ][i] = result[ slot ];
+        result[ slot ] = 0.;
+      }
+    }
+  }
+}
@@ -0,0 +1,11 @@
+static
+ReactionIndex
+makeReactionIndex( std::vector< SpinGroup< Formalism, BoundaryOption > >& groups ) {
+
+  ReactionIndex index;
+  for ( auto& group : groups ) {
+
+    group.internReactions( index );
+  }
+  return index;
+}
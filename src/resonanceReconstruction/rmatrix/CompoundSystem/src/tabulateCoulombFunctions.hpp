@@ -0,0 +1,20 @@
+/**
+ *  @brief Tabulate the penetrability, shift factor and phase shift of the
+ *         charged particle channels in the compound system over an energy
+ *         interval
+ *
+ *  The tabulated values replace the evaluation of the Coulomb wave functions
+ *  at every energy in the interval (see Channel::tabulateCoulombFunctions).
+ *
+ *  @param[in] lower       the lower energy of the interval
+ *  @param[in] upper       the upper energy of the interval
+ *  @param[in] tolerance   the tolerance on the interpolated values
+ */
+void tabulateCoulombFunctions( const Energy& lower, const Energy& upper,
+                               double tolerance ) {
+
+  for ( auto& group : this->groups_ ) {
+
+    group.tabulateCoulombFunctions( lower, upper, tolerance );
+  }
+}
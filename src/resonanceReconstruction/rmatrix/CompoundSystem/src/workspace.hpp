@@ -0,0 +1,13 @@
+/**
+ *  @brief Return a workspace for the evaluation of the compound system
+ */
+EvaluationWorkspace workspace() const {
+
+  std::vector< SpinGroupWorkspace > groups;
+  groups.reserve( this->groups_.size() );
+  for ( const auto& group : this->groups_ ) {
+
+    groups.push_back( group.workspace() );
+  }
+  return EvaluationWorkspace( std::move( groups ) );
+}
@@ -756,5 +756,252 @@ SCENARIO( "evaluate" ) {
       CHECK( 1.099364e+1 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "cross sections can be calculated using the reaction slots" ) {
+
+      const auto& index = system.reactionIndex();
+      CHECK( 2 == index.size() );
+      CHECK( true == index.contains( elas ) );
+      CHECK( true == index.contains( capt ) );
+
+      std::vector< double > xs( index.size(), 0. );
+      system.evaluate( 1e-5 * electronVolt, xs );
+      CHECK( 8.781787e-2 == Approx( xs[ index.slot( elas ) ] ) );
+      CHECK( 7.082910e+1 == Approx( xs[ index.slot( capt ) ] ) );
+      std::fill( xs.begin(), xs.end(), 0. );
+
+      system.evaluate( 1.264000e+5 * electronVolt, xs );
+      CHECK( 3.830078e+1 == Approx( xs[ index.slot( elas ) ] ) );
+      CHECK( 1.278686e+1 == Approx( xs[ index.slot( capt ) ] ) );
+    } // THEN
+
+    THEN( "cross sections can be calculated on an energy grid" ) {
+
+      auto table = system.evaluate( { 1e-5 * electronVolt,
+                                      1e-1 * electronVolt,
+                                      1e+1 * electronVolt,
+                                      1.264000e+5 * electronVolt,
+                                      1.779400e+5 * electronVolt } );
+      CHECK( 5 == table.numberEnergies() );
+      CHECK( 2 == table.numberReactions() );
+
+      auto elastic = table.values( elas );
+      CHECK( 5 == elastic.size() );
+      CHECK( 8.781787e-2 == Approx( elastic[0] ) );
+      CHECK( 8.780687e-2 == Approx( elastic[1] ) );
+      CHECK( 8.672103e-2 == Approx( elastic[2] ) );
+      CHECK( 3.830078e+1 == Approx( elastic[3] ) );
+      CHECK( 2.010266e+1 == Approx( elastic[4] ) );
+
+      auto capture = table.values( capt );
+      CHECK( 5 == capture.size() );
+      CHECK( 7.082910e+1 == Approx( capture[0] ) );
+      CHECK( 7.083087e-1 == Approx( capture[1] ) );
+      CHECK( 7.100643e-2 == Approx( capture[2] ) );
+      CHECK( 1.278686e+1 == Approx( capture[3] ) );
+      CHECK( 1.099364e+1 == Approx( capture[4] ) );
+
+      // the values are identical to those of the pointwise evaluation
+      for ( unsigned int i = 0; i < table.numberEnergies(); ++i ) {
+
+        std::map< ReactionID, CrossSection > xs;
+        system.evaluate( table.energies()[i], xs );
+        CHECK( xs[ elas ].value == elastic[i] );
+        CHECK( xs[ capt ].value == capture[i] );
+      }
+    } // THEN
+
+    THEN( "cross sections can be calculated using an external workspace" ) {
+
+      const auto& constant = system;
+      auto workspace = constant.workspace();
+      CHECK( 5 == workspace.numberSpinGroups() );
+
+      std::map< ReactionID, CrossSection > xs;
+      constant.evaluate( 1e-5 * electronVolt, xs, workspace );
+      CHECK( 2 == xs.size() );
+      CHECK( 8.781787e-2 == Approx( xs[ elas ].value ) );
+      CHECK( 7.082910e+1 == Approx( xs[ capt ].value ) );
+      xs.clear();
+
+      constant.evaluate( 1.264000e+5 * electronVolt, xs, workspace );
+      CHECK( 2 == xs.size() );
+      CHECK( 3.830078e+1 == Approx( xs[ elas ].value ) );
+      CHECK( 1.278686e+1 == Approx( xs[ capt ].value ) );
+      xs.clear();
+
+      // reusing the workspace does not change the results
+      constant.evaluate( 1e-5 * electronVolt, xs, workspace );
+      CHECK( 2 == xs.size() );
+      CHECK( 8.781787e-2 == Approx( xs[ elas ].value ) );
+      CHECK( 7.082910e+1 == Approx( xs[ capt ].value ) );
+    } // THEN
+
+    THEN( "cross sections can be calculated by evaluating the spin groups "
+          "concurrently" ) {
+
+      const auto& index = system.reactionIndex();
+      auto workspace = system.workspace();
+      for ( auto energy : { 1e-5 * electronVolt, 9.480000e+3 * electronVolt,
+                            1.264000e+5 * electronVolt } ) {
+
+        std::vector< double > serial( index.size(), 0. );
+        system.evaluate( energy, serial, workspace );
+        for ( unsigned int threads : { 1u, 2u, 5u, 8u } ) {
+
+          // the values are bitwise identical to the serial values
+          std::vector< double > parallel( index.size(), 0. );
+          system.evaluate( energy, parallel, workspace, threads );
+          CHECK( serial == parallel );
+        }
+      }
+
+      std::vector< double > xs( index.size(), 0. );
+      system.evaluate( 1.264000e+5 * electronVolt, xs, workspace, 2 );
+      CHECK( 3.830078e+1 == Approx( xs[ index.slot( elas ) ] ) );
+      CHECK( 1.278686e+1 == Approx( xs[ index.slot( capt ) ] ) );
+    } // THEN
+
+    THEN( "cross sections can be calculated on an energy grid using "
+          "multiple threads" ) {
+
+      std::vector< Energy > energies;
+      for ( unsigned int i = 0; i < 500; ++i ) {
+
+        energies.push_back( 1e-5 * std::pow( 1.05, i ) * electronVolt );
+      }
+
+      auto serial = system.evaluate( energies );
+      for ( unsigned int threads : { 1u, 2u, 4u } ) {
+
+        auto parallel = system.evaluate( energies, threads );
+        CHECK( 500 == parallel.numberEnergies() );
+        CHECK( 2 == parallel.numberReactions() );
+        CHECK( serial.values( elas ) == parallel.values( elas ) );
+        CHECK( serial.values( capt ) == parallel.values( capt ) );
+      }
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "valid data for a CompoundSystem with a SpinGroup with two fission "
+         "channels" ) {
+
+    // test based on Pu239 ENDF/B-VIII.0 LRF3 resonance evaluation (some of the
+    // widths used in this test were negative in the original evaluation)
+    // data given in Gamma = 2 gamma^2 P(Er) so conversion is required
+
+    // both fission channels contribute to the same reaction
+
+    // particles
+    Particle photon( ParticleID( "g" ), 0.0 * daltons,
+                     0.0 * elementary, 1., +1);
+    Particle neutron( ParticleID( "n" ), neutronMass,
+                      0.0 * elementary, 0.5, +1);
+    Particle pu240( ParticleID( "Pu240" ), 2.379916e+2 * neutronMass,
+                    94.0 * elementary, 0.5, +1);
+    Particle pu239( ParticleID( "Pu239" ), 2.369986e+2 * neutronMass,
+                    94.0 * elementary, 0.5, +1);
+
+    // particle pairs
+    ParticlePair in( neutron, pu239 );
+    ParticlePair out1( photon, pu240 );
+    ParticlePair out2( neutron, pu239, ParticlePairID( "fission" ) );
+
+    // channels
+    Channel< Photon > capture( in, out1, 0. * electronVolt, { 0, 0.0, 0.0, +1 },
+                               { 0.0 * rootBarn },
+                               0.0 );
+    Channel< Neutron > elastic( in, in, 0. * electronVolt, { 0, 0.5, 0.0, +1 },
+                                { 9.410000e-1 * rootBarn },
+                                0.0 );
+    Channel< Fission > fission1( in, out2, "fission1", 0. * electronVolt,
+                                 { 0, 0.0, 0.0, +1 },
+                                 { 9.410000e-1 * rootBarn },
+                                 0.0 );
+    Channel< Fission > fission2( in, out2, "fission2", 0. * electronVolt,
+                                 { 0, 0.0, 0.0, +1 },
+                                 { 9.410000e-1 * rootBarn },
+                                 0.0 );
+
+    // conversion from Gamma to gamma
+    auto eGamma = [&] ( double width, const Energy& energy ) -> ReducedWidth {
+      return std::sqrt( width / 2. / elastic.penetrability( energy ) ) *
+             rootElectronVolt;
+    };
+    auto fGamma = [&] ( double width ) -> ReducedWidth {
+      return std::sqrt( width / 2. ) * rootElectronVolt;
+    };
+    auto cGamma = [&] ( double width ) -> ReducedWidth {
+      return std::sqrt( width / 2. ) * rootElectronVolt;
+    };
+
+    // multiple resonance table
+    ResonanceTable multiple(
+      { elastic.channelID(), fission1.channelID(), fission2.channelID() },
+      { Resonance( 1.541700e+1 * electronVolt,
+                   { eGamma( 2.056203e-3, 1.541700e+1 * electronVolt ),
+                     fGamma( 1.093928e-6 ),
+                     fGamma( 7.550000e-1 ) },
+                   cGamma( 4.054259e-2 ) ),
+        Resonance( 3.232700e+1 * electronVolt,
+                   { eGamma( 8.678823e-4, 3.232700e+1 * electronVolt ),
+                     fGamma( 5.235058e-3 ),
+                     fGamma( 1.279000e-1 ) },
+                   cGamma( 4.182541e-2 ) ),
+        Resonance( 4.753400e+1 * electronVolt,
+                   { eGamma( 5.171861e-3, 4.753400e+1 * electronVolt ),
+                     fGamma( 5.548812e-1 ),
+                     fGamma( 1.274000e-7 ) },
+                   cGamma( 2.938826e-2 ) ) } );
+
+    SpinGroup< ReichMoore, ShiftFactor >
+        group( { elastic, fission1, fission2 }, std::move( multiple ) );
+
+    CompoundSystem< ReichMoore, ShiftFactor > system( { group } );
+
+    ReactionID elas( "n,Pu239->n,Pu239" );
+    ReactionID fiss( "n,Pu239->fission" );
+    ReactionID capt( "n,Pu239->capture" );
+
+    THEN( "cross sections can be calculated by evaluating the spin groups "
+          "concurrently" ) {
+
+      const auto& index = system.reactionIndex();
+      CHECK( 3 == index.size() );
+
+      auto workspace = system.workspace();
+      for ( auto energy : { 1e-5 * electronVolt, 1.541700e+1 * electronVolt,
+                            3.232700e+1 * electronVolt,
+                            4.753400e+1 * electronVolt } ) {
+
+        std::vector< double > serial( index.size(), 0. );
+        system.evaluate( energy, serial, workspace );
+
+        std::map< ReactionID, CrossSection > xs;
+        system.evaluate( energy, xs );
+
+        std::vector< double > reference( index.size(), 0. );
+        system.evaluate( energy, reference, workspace, 1 );
+        for ( unsigned int threads : { 1u, 2u, 4u } ) {
+
+          // every fission channel is added once
+          std::vector< double > parallel( index.size(), 0. );
+          system.evaluate( energy, parallel, workspace, threads );
+          CHECK( xs[ elas ].value ==
+                 Approx( parallel[ index.slot( elas ) ] ) );
+          CHECK( xs[ fiss ].value ==
+                 Approx( parallel[ index.slot( fiss ) ] ) );
+          CHECK( xs[ capt ].value ==
+                 Approx( parallel[ index.slot( capt ) ] ) );
+          for ( unsigned int slot = 0; slot < index.size(); ++slot ) {
+
+            CHECK( serial[ slot ] == Approx( parallel[ slot ] ) );
+          }
+
+          // the values are identical for any number of threads
+          CHECK( reference == parallel );
+        }
+      }
+    } // THEN
   } // GIVEN
 } // SCENARIO
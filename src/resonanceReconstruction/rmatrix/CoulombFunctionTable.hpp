@@ -0,0 +1,80 @@
+/**
+ *  @class
+ *  @brief A table of the penetrability, shift factor and phase shift of a
+ *         charged particle channel as a function of the wave number
+ *
+ *  For a charged particle channel with energy independent channel radii, the
+ *  values of rho = ka and the Sommerfeld parameter eta only depend on the wave
+ *  number k so that the penetrability P, shift factor S and phase shift phi
+ *  are smooth functions of k (and thus of rho). These functions vary on a scale
+ *  that is much larger than the resonance structure so that they can be
+ *  tabulated and interpolated instead of evaluating the Coulomb wave functions
+ *  at every energy.
+ *
+ *  The values are interpolated using monotone piecewise cubic Hermite
+ *  interpolation (with the Fritsch-Butland weighted harmonic mean slopes),
+ *  which does not introduce oscillations between the tabulated points. The
+ *  penetrability is interpolated through its logarithm. The phase shift
+ *  obtained from the Coulomb functions is folded onto [0, pi], which
+ *  introduces kinks whenever the phase passes through a multiple of pi. It is
+ *  therefore tabulated as a continuous (unwrapped) phase that is folded again
+ *  after interpolation. The tabulated points are determined
+ *  adaptively: an interval is halved until the interpolated values at the
+ *  middle of the interval agree with the exact values within the requested
+ *  tolerance (see generate() for the details).
+ *
+ *  All values are raw double values, the wave numbers are given in
+ *  1/sqrt(barn).
+ */
+class CoulombFunctionTable {
+
+  /* fields */
+  std::vector< double > k_;
+  std::array< std::vector< double >, 3 > values_;
+  std::array< std::vector< double >, 3 > slopes_;
+
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/calculateSlopes.hpp"
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/interpolate.hpp"
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/unwrapPhase.hpp"
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/foldPhase.hpp"
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/generate.hpp"
+
+public:
+
+  /* constructor */
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/ctor.hpp"
+
+  /**
+   *  @brief Return the number of points in the table
+   */
+  unsigned int numberPoints() const { return this->k_.size(); }
+
+  /**
+   *  @brief Return the tabulated wave numbers (in 1/sqrt(barn))
+   */
+  const std::vector< double >& waveNumbers() const { return this->k_; }
+
+  /**
+   *  @brief Return the lowest wave number in the table (in 1/sqrt(barn))
+   */
+  double lowerWaveNumber() const { return this->k_.front(); }
+
+  /**
+   *  @brief Return the highest wave number in the table (in 1/sqrt(barn))
+   */
+  double upperWaveNumber() const { return this->k_.back(); }
+
+  /**
+   *  @brief Return whether or not a wave number is inside the table
+   *
+   *  @param[in] k   the wave number (in 1/sqrt(barn))
+   */
+  bool isInside( double k ) const {
+
+    return ( k >= this->lowerWaveNumber() ) and
+           ( k <= this->upperWaveNumber() );
+  }
+
+  #include "resonanceReconstruction/rmatrix/CoulombFunctionTable/src/call.hpp"
+};
@@ -0,0 +1,67 @@
+/**
+ *  @brief Calculate the slopes at the tabulated points for monotone piecewise
+ *         cubic Hermite interpolation
+ *
+ *  The slope at an interior point is the weighted harmonic mean of the
+ *  secants of the adjacent intervals as proposed by Fritsch and Butland (or
+ *  zero when the data has a local extremum in the point). The slopes at the end points use a three point
+ *  formula that is limited to preserve the shape of the data.
+ *
+ *  @param[in] x        the x values
+ *  @param[in] y        the y values
+ *  @param[out] slopes  the slopes in each point
+ */
+static void calculateSlopes( const std::vector< double >& x,
+                             const std::vector< double >& y,
+                             std::vector< double >& slopes ) {
+
+  const unsigned int size = x.size();
+  slopes.resize( size );
+
+  auto secant = [&] ( unsigned int i )
+                    { return ( y[i + 1] - y[i] ) / ( x[i + 1] - x[i] ); };
+  auto width = [&] ( unsigned int i ) { return x[i + 1] - x[i]; };
+
+  if ( size == 2 ) {
+
+    slopes[0] = slopes[1] = secant( 0 );
+    return;
+  }
+
+  // interior points
+  for ( unsigned int i = 1; i < size - 1; ++i ) {
+
+    const double left = secant( i - 1 );
+    const double right = secant( i );
+    if ( left * right <= 0. ) {
+
+      slopes[i] = 0.;
+    }
+    else {
+
+      const double w1 = 2. * width( i ) + width( i - 1 );
+      const double w2 = width( i ) + 2. * width( i - 1 );
+      slopes[i] = ( w1 + w2 ) / ( w1 / left + w2 / right );
+    }
+  }
+
+  // end points
+  auto edge = [] ( double h0, double h1, double delta0, double delta1 ) {
+
+    double slope = ( ( 2. * h0 + h1 ) * delta0 - h0 * delta1 ) / ( h0 + h1 );
+    if ( slope * delta0 <= 0. ) {
+
+      slope = 0.;
+    }
+    else if ( ( delta0 * delta1 < 0. ) and
+              ( std::abs( slope ) > 3. * std::abs( delta0 ) ) ) {
+
+      slope = 3. * delta0;
+    }
+    return slope;
+  };
+
+  slopes.front() = edge( width( 0 ), width( 1 ), secant( 0 ), secant( 1 ) );
+  slopes.back() = edge( width( size - 2 ), width( size - 3 ),
+                        secant( size - 2 ), secant( size - 3 ) );
+}
@@ -0,0 +1,30 @@
+/**
+ *  @brief Return the interpolated penetrability, shift factor and phase shift
+ *         at a given wave number
+ *
+ *  @param[in] k   the wave number (in 1/sqrt(barn), inside the table)
+ */
+std::array< double, 3 > operator()( double k ) const {
+
+  const unsigned int size = this->k_.size();
+  const auto upper = std::upper_bound( this->k_.begin(), this->k_.end(), k );
+  const unsigned int i = std::min(
+      static_cast< unsigned int >( std::max(
+          std::distance( this->k_.begin(), upper ) - 1, std::ptrdiff_t( 0 ) ) ),
+      size - 2 );
+
+  std::array< double, 3 > result;
+  for ( unsigned int q = 0; q < 3; ++q ) {
+
+    result[q] = interpolate( this->k_[i], this->k_[i + 1],
+                             this->values_[q][i], this->values_[q][i + 1],
+                             this->slopes_[q][i], this->slopes_[q][i + 1], k );
+  }
+
+  // the penetrability is tabulated as its logarithm and the phase shift as
+  // an unwrapped phase
+  result[0] = result[0] <= std::log( std::numeric_limits< double >::min() )
+              ? 0. : std::exp( result[0] );
+  result[2] = foldPhase( result[2] );
+  return result;
+}
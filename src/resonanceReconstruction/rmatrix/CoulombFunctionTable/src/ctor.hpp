@@ -0,0 +1,36 @@
+/**
+ *  @brief Constructor
+ *
+ *  The function is called as function( k ) and must return the penetrability,
+ *  shift factor and phase shift at the wave number k as a std::array of three
+ *  values.
+ *
+ *  @param[in] function    the function to be tabulated
+ *  @param[in] lower       the lowest wave number (in 1/sqrt(barn), strictly
+ *                         positive)
+ *  @param[in] upper       the highest wave number (in 1/sqrt(barn))
+ *  @param[in] tolerance   the tolerance on the interpolated values
+ */
+template < typename Function >
+CoulombFunctionTable( Function&& function, double lower, double upper,
+                      double tolerance ) {
+
+  if ( not ( lower > 0. ) or not ( upper > lower ) ) {
+
+    Log::error( "The wave number interval for a Coulomb function table must "
+                "be strictly positive and not empty" );
+    Log::info( "Lower wave number: {}", lower );
+    Log::info( "Upper wave number: {}", upper );
+    throw std::exception();
+  }
+
+  if ( not ( tolerance > 0. ) ) {
+
+    Log::error( "The tolerance for a Coulomb function table must be "
+                "strictly positive" );
+    Log::info( "Tolerance: {}", tolerance );
+    throw std::exception();
+  }
+
+  this->generate( function, lower, upper, tolerance );
+}
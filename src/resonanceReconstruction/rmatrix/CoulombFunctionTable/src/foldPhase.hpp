@@ -0,0 +1,12 @@
+/**
+ *  @brief Fold an unwrapped phase shift onto [0, pi]
+ *
+ *  This is the inverse of unwrapPhase(): the phase is reduced to [-pi, pi]
+ *  after which its absolute value is returned.
+ *
+ *  @param[in] phase   the unwrapped phase shift
+ */
+static double foldPhase( double phase ) {
+
+  return std::abs( phase - 2. * pi * std::round( phase / ( 2. * pi ) ) );
+}
@@ -0,0 +1,152 @@
+/**
+ *  @brief Generate the tabulated points
+ *
+ *  The table starts from a logarithmic grid. In every iteration, the
+ *  interpolated values in the middle of each interval are compared to the
+ *  exact values and the intervals for which the difference exceeds the
+ *  tolerance are halved (the midpoint becomes a tabulated point). The exact
+ *  value in the middle of an interval is only calculated once.
+ *
+ *  The penetrability varies over many orders of magnitude below the Coulomb
+ *  barrier, so its logarithm is tabulated instead and the tolerance applies to
+ *  that logarithm (i.e. it is a relative tolerance on the penetrability). The
+ *  phase shift obtained from the Coulomb functions is folded onto [0, pi], so
+ *  it is unwrapped into a continuous phase (see unwrapPhase()): the phase on
+ *  the initial grid is chosen closest to the linear extrapolation of the
+ *  preceding points and the phase in the middle of an interval is chosen
+ *  closest to the mean of the values at its boundaries. For the shift factor and the unwrapped phase shift, the
+ *  tolerance is relative for values larger than 1 in magnitude and absolute
+ *  otherwise.
+ *
+ *  Intervals are no longer halved once their relative width is below 1e-12
+ *  or when the table has reached its maximum size.
+ *
+ *  @param[in] function    the function to be tabulated
+ *  @param[in] lower       the lowest wave number
+ *  @param[in] upper       the highest wave number
+ *  @param[in] tolerance   the tolerance on the interpolated values
+ */
+template < typename Function >
+void generate( Function& function, double lower, double upper,
+               double tolerance ) {
+
+  using Values = std::array< double, 3 >;
+
+  constexpr unsigned int initial = 16;
+  constexpr unsigned int maximum = 100000;
+  constexpr double resolution = 1e-12;
+
+  // the function values to be tabulated (a zero penetrability is replaced by
+  // the smallest normalised double so that its logarithm is finite)
+  auto evaluate = [&] ( double x ) {
+
+    Values values = function( x );
+    values[0] = std::log( std::max( values[0],
+                                    std::numeric_limits< double >::min() ) );
+    return values;
+  };
+
+  // initial logarithmic grid
+  std::vector< double > k( initial );
+  std::vector< Values > y( initial );
+  for ( unsigned int i = 0; i < initial; ++i ) {
+
+    k[i] = i == initial - 1
+           ? upper
+           : lower * std::pow( upper / lower, double( i ) / ( initial - 1 ) );
+    y[i] = evaluate( k[i] );
+    if ( i > 1 ) {
+
+      // the phase is unwrapped using a linear extrapolation from the previous
+      // points (the folded phase is symmetric around its kinks)
+      const double slope = ( y[i - 1][2] - y[i - 2][2] ) /
+                           ( k[i - 1] - k[i - 2] );
+      y[i][2] = unwrapPhase( y[i][2],
+                             y[i - 1][2] + slope * ( k[i] - k[i - 1] ) );
+    }
+  }
+  std::vector< std::optional< Values > > middle( initial - 1 );
+
+  auto store = [&] {
+
+    this->k_ = k;
+    for ( unsigned int q = 0; q < 3; ++q ) {
+
+      this->values_[q].resize( k.size() );
+      for ( unsigned int i = 0; i < k.size(); ++i ) {
+
+        this->values_[q][i] = y[i][q];
+      }
+      calculateSlopes( this->k_, this->values_[q], this->slopes_[q] );
+    }
+  };
+
+  auto isAccurate = [&] ( unsigned int i, double x, const Values& exact ) {
+
+    for ( unsigned int q = 0; q < 3; ++q ) {
+
+      const double value = interpolate( k[i], k[i + 1],
+                                        this->values_[q][i],
+                                        this->values_[q][i + 1],
+                                        this->slopes_[q][i],
+                                        this->slopes_[q][i + 1], x );
+      const double scale = q == 0 ? 1. : std::max( std::abs( exact[q] ), 1. );
+      if ( std::abs( value - exact[q] ) > tolerance * scale ) {
+
+        return false;
+      }
+    }
+    return true;
+  };
+
+  bool refined = true;
+  while ( refined ) {
+
+    store();
+    refined = false;
+
+    std::vector< double > nk;
+    std::vector< Values > ny;
+    std::vector< std::optional< Values > > nmiddle;
+    nk.reserve( 2 * k.size() );
+    ny.reserve( 2 * k.size() );
+    nmiddle.reserve( 2 * k.size() );
+    for ( unsigned int i = 0; i < k.size() - 1; ++i ) {
+
+      nk.push_back( k[i] );
+      ny.push_back( y[i] );
+
+      const double x = 0.5 * ( k[i] + k[i + 1] );
+      if ( not middle[i] ) {
+
+        middle[i] = evaluate( x );
+        ( *middle[i] )[2] = unwrapPhase( ( *middle[i] )[2],
+                                         0.5 * ( y[i][2] + y[i + 1][2] ) );
+      }
+      const Values& exact = *middle[i];
+
+      const bool accurate =
+          ( k[i + 1] - k[i] <= resolution * k[i + 1] ) or
+          ( nk.size() + k.size() - i >= maximum ) or
+          isAccurate( i, x, exact );
+      if ( accurate ) {
+
+        nmiddle.push_back( middle[i] );
+      }
+      else {
+
+        nk.push_back( x );
+        ny.push_back( exact );
+        nmiddle.push_back( std::nullopt );
+        nmiddle.push_back( std::nullopt );
+        refined = true;
+      }
+    }
+    nk.push_back( k.back() );
+    ny.push_back( y.back() );
+
+    k.swap( nk );
+    y.swap( ny );
+    middle.swap( nmiddle );
+  }
+}
@@ -0,0 +1,20 @@
+/**
+ *  @brief Cubic Hermite interpolation on an interval
+ *
+ *  @param[in] x0   the lower x value of the interval
+ *  @param[in] x1   the upper x value of the interval
+ *  @param[in] y0   the y value at x0
+ *  @param[in] y1   the y value at x1
+ *  @param[in] d0   the slope at x0
+ *  @param[in] d1   the slope at x1
+ *  @param[in] x    the x value for which the y value must be interpolated
+ */
+static double interpolate( double x0, double x1, double y0, double y1,
+                           double d0, double d1, double x ) {
+
+  const double h = x1 - x0;
+  const double t = ( x - x0 ) / h;
+  const double u = 1. - t;
+  return u * u * ( ( 1. + 2. * t ) * y0 + t * h * d0 )
+         + t * t * ( ( 3. - 2. * t ) * y1 - u * h * d1 );
+}
@@ -0,0 +1,23 @@
+/**
+ *  @brief Return the unwrapped phase shift closest to a reference value
+ *
+ *  The phase shift obtained from the Coulomb functions is folded onto
+ *  [0, pi]: it is the absolute value of the phase reduced to [-pi, pi]. All
+ *  values +/-phi + 2 pi n give the same folded value, the one closest to the
+ *  reference value is returned.
+ *
+ *  @param[in] phase       the folded phase shift
+ *  @param[in] reference   the reference value
+ */
+static double unwrapPhase( double phase, double reference ) {
+
+  auto closest = [reference] ( double value ) {
+
+    return value + 2. * pi * std::round( ( reference - value ) / ( 2. * pi ) );
+  };
+
+  const double positive = closest( phase );
+  const double negative = closest( -phase );
+  return std::abs( positive - reference ) <= std::abs( negative - reference )
+         ? positive : negative;
+}
@@ -0,0 +1,110 @@
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+// convenience typedefs
+using CoulombFunctionTable = rmatrix::CoulombFunctionTable;
+
+SCENARIO( "CoulombFunctionTable" ) {
+
+  GIVEN( "a smooth function and a wave number interval" ) {
+
+    auto function = [] ( double k ) {
+
+      return std::array< double, 3 >{ { std::exp( -2. / k ),
+                                        std::sin( k ),
+                                        std::atan( k ) } };
+    };
+
+    THEN( "a CoulombFunctionTable can be constructed" ) {
+
+      CoulombFunctionTable table( function, 0.5, 5., 1e-6 );
+
+      CHECK( 0.5 == table.lowerWaveNumber() );
+      CHECK( 5. == table.upperWaveNumber() );
+      CHECK( 16 < table.numberPoints() );
+      CHECK( table.numberPoints() == table.waveNumbers().size() );
+
+      CHECK( false == table.isInside( 0.4 ) );
+      CHECK( true == table.isInside( 0.5 ) );
+      CHECK( true == table.isInside( 2. ) );
+      CHECK( true == table.isInside( 5. ) );
+      CHECK( false == table.isInside( 5.1 ) );
+
+      // the tabulated values are reproduced
+      for ( auto k : table.waveNumbers() ) {
+
+        auto exact = function( k );
+        auto values = table( k );
+        CHECK( exact[0] == Approx( values[0] ).epsilon( 1e-12 ) );
+        CHECK( exact[1] == values[1] );
+        CHECK( exact[2] == values[2] );
+      }
+
+      // the interpolated values are within the tolerance
+      for ( unsigned int i = 0; i <= 1000; ++i ) {
+
+        const double k = 0.5 + 4.5 * i / 1000.;
+        auto exact = function( k );
+        auto values = table( k );
+        CHECK( std::abs( exact[0] - values[0] ) <= 1e-5 * exact[0] );
+        CHECK( std::abs( exact[1] - values[1] ) <= 1e-5 );
+        CHECK( std::abs( exact[2] - values[2] ) <= 1e-5 );
+      }
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "a phase shift that is folded onto [0, pi]" ) {
+
+    // the phase 3 - 2k decreases through 0, -pi and -2pi on [0.5, 5]
+    auto function = [] ( double k ) {
+
+      return std::array< double, 3 >{ { 1., 0.,
+                                        std::acos( std::cos( 3. - 2. * k ) ) } };
+    };
+
+    THEN( "the unwrapped phase is interpolated without refining the kinks" ) {
+
+      CoulombFunctionTable table( function, 0.5, 5., 1e-6 );
+
+      // the unwrapped phase is linear in k
+      CHECK( 16 == table.numberPoints() );
+
+      for ( unsigned int i = 0; i <= 1000; ++i ) {
+
+        const double k = 0.5 + 4.5 * i / 1000.;
+        auto exact = function( k );
+        auto values = table( k );
+        CHECK( 1. == values[0] );
+        CHECK( 0. == values[1] );
+        CHECK( values[2] >= 0. );
+        CHECK( values[2] <= pi );
+        CHECK( std::abs( exact[2] - values[2] ) <= 1e-6 );
+      }
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "invalid data for a CoulombFunctionTable" ) {
+
+    auto function = [] ( double k ) {
+
+      return std::array< double, 3 >{ { k, k, k } };
+    };
+
+    THEN( "an exception is thrown for an invalid wave number interval" ) {
+
+      CHECK_THROWS( CoulombFunctionTable( function, 0., 1., 1e-6 ) );
+      CHECK_THROWS( CoulombFunctionTable( function, 1., 1., 1e-6 ) );
+      CHECK_THROWS( CoulombFunctionTable( function, 2., 1., 1e-6 ) );
+    } // THEN
+
+    THEN( "an exception is thrown for an invalid tolerance" ) {
+
+      CHECK_THROWS( CoulombFunctionTable( function, 1., 2., 0. ) );
+      CHECK_THROWS( CoulombFunctionTable( function, 1., 2., -1e-6 ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
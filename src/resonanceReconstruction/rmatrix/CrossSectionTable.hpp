@@ -0,0 +1,64 @@
+/**
+ *  @class
+ *  @brief Cross section values for a set of reactions on an energy grid
+ *
+ *  The cross section values are stored in a columnar fashion: each reaction
+ *  has a single contiguous array of values (in barn) with one value for each
+ *  energy in the energy grid. The reactions are kept sorted.
+ */
+class CrossSectionTable {
+
+  /* fields */
+  std::vector< Energy > energies_;
+  std::vector< ReactionID > reactions_;
+  std::vector< std::vector< double > > values_;
+
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable/src/index.hpp"
+
+public:
+
+  /**
+   *  @brief The number of energy values that are evaluated together when
+   *         filling a table
+   */
+  static constexpr unsigned int tileSize = 64;
+
+  /* constructor */
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable/src/ctor.hpp"
+
+  /**
+   *  @brief Return the number of energy values
+   */
+  unsigned int numberEnergies() const { return this->energies_.size(); }
+
+  /**
+   *  @brief Return the number of reactions
+   */
+  unsigned int numberReactions() const { return this->reactions_.size(); }
+
+  /**
+   *  @brief Return the energy grid
+   */
+  auto energies() const { return ranges::view::all( this->energies_ ); }
+
+  /**
+   *  @brief Return the reaction identifiers
+   */
+  auto reactions() const { return ranges::view::all( this->reactions_ ); }
+
+  /**
+   *  @brief Return whether or not a given reaction is present in the table
+   *
+   *  @param[in] reaction   the reaction identifier
+   */
+  bool hasReaction( const ReactionID& reaction ) const {
+
+    return this->index( reaction ) < this->numberReactions();
+  }
+
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable/src/values.hpp"
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable/src/crossSections.hpp"
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable/src/column.hpp"
+  #include "resonanceReconstruction/rmatrix/CrossSectionTable/src/columns.hpp"
+};
@@ -0,0 +1,23 @@
+/**
+ *  @brief Return the cross section values (in barn) for a given reaction,
+ *         adding the reaction to the table if it is not present yet
+ *
+ *  A newly added reaction has a zero cross section value at every energy.
+ *
+ *  @param[in] reaction   the reaction identifier
+ */
+std::vector< double >& column( const ReactionID& reaction ) {
+
+  const auto iter = std::lower_bound( this->reactions_.begin(),
+                                      this->reactions_.end(),
+                                      reaction, std::less< ReactionID >() );
+  const auto index = std::distance( this->reactions_.begin(), iter );
+  if ( ( iter == this->reactions_.end() ) or
+       std::less< ReactionID >()( reaction, *iter ) ) {
+
+    this->reactions_.insert( iter, reaction );
+    this->values_.insert( this->values_.begin() + index,
+                          std::vector< double >( this->numberEnergies(), 0. ) );
+  }
+  return this->values_[ index ];
+}
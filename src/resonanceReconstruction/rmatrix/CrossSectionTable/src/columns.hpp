@@ -0,0 +1,25 @@
+/**
+ *  @brief Return pointers to the cross section values (in barn) for every
+ *         reaction in a reaction index, ordered by slot
+ *
+ *  Reactions that are not present yet are added to the table first. The
+ *  pointers remain valid as long as no other reactions are added to the
+ *  table.
+ *
+ *  @param[in] index   the reaction index
+ */
+std::vector< double* > columns( const ReactionIndex& index ) {
+
+  for ( const auto& reaction : index.reactions() ) {
+
+    this->column( reaction );
+  }
+
+  std::vector< double* > columns;
+  columns.reserve( index.size() );
+  for ( const auto& reaction : index.reactions() ) {
+
+    columns.push_back( this->column( reaction ).data() );
+  }
+  return columns;
+}
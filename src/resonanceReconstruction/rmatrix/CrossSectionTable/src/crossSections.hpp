@@ -0,0 +1,26 @@
+/**
+ *  @brief Return the cross sections for a given reaction
+ *
+ *  @param[in] reaction   the reaction identifier
+ */
+auto crossSections( const ReactionID& reaction ) const {
+
+  return ranges::view::all( this->values( reaction ) )
+           | ranges::view::transform( [] ( double value ) -> CrossSection
+                                         { return value * barns; } );
+}
+
+/**
+ *  @brief Return the cross sections for all reactions at a given energy index
+ *
+ *  @param[in] index   the index of the energy value in the energy grid
+ */
+std::map< ReactionID, CrossSection > crossSections( unsigned int index ) const {
+
+  std::map< ReactionID, CrossSection > result;
+  for ( unsigned int r = 0; r < this->numberReactions(); ++r ) {
+
+    result[ this->reactions_[r] ] = this->values_[r][ index ] * barns;
+  }
+  return result;
+}
@@ -0,0 +1,11 @@
+/**
+ *  @brief Constructor
+ *
+ *  The table is created without any reactions. Reactions are added (with
+ *  zero cross section values) when they are first requested through the
+ *  column() function.
+ *
+ *  @param[in] energies   the energy grid (ne values)
+ */
+CrossSectionTable( std::vector< Energy >&& energies ) :
+    energies_( std::move( energies ) ) {}
@@ -0,0 +1,16 @@
+/**
+ *  @brief Return the index of the reaction or the number of reactions if the
+ *         reaction is not present
+ *
+ *  @param[in] reaction   the reaction identifier
+ */
+unsigned int index( const ReactionID& reaction ) const {
+
+  const auto iter = std::lower_bound( this->reactions_.begin(),
+                                      this->reactions_.end(),
+                                      reaction, std::less< ReactionID >() );
+  return ( ( iter != this->reactions_.end() ) and
+           not std::less< ReactionID >()( reaction, *iter ) )
+         ? std::distance( this->reactions_.begin(), iter )
+         : this->numberReactions();
+}
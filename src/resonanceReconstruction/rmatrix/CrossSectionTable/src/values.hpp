@@ -0,0 +1,16 @@
+/**
+ *  @brief Return the cross section values (in barn) for a given reaction
+ *
+ *  @param[in] reaction   the reaction identifier
+ */
+const std::vector< double >& values( const ReactionID& reaction ) const {
+
+  const unsigned int index = this->index( reaction );
+  if ( index == this->numberReactions() ) {
+
+    Log::error( "The requested reaction is not present in the cross section "
+                "table" );
+    throw std::exception();
+  }
+  return this->values_[ index ];
+}
@@ -0,0 +1,82 @@
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+// convenience typedefs
+using CrossSectionTable = rmatrix::CrossSectionTable;
+using ReactionID = rmatrix::ReactionID;
+
+SCENARIO( "CrossSectionTable" ) {
+
+  GIVEN( "valid data for a CrossSectionTable" ) {
+
+    std::vector< Energy > energies = { 1e-5 * electronVolt,
+                                       1. * electronVolt,
+                                       1e+3 * electronVolt };
+
+    ReactionID elas( "n,Fe54->n,Fe54" );
+    ReactionID capt( "n,Fe54->capture" );
+
+    THEN( "a CrossSectionTable can be constructed and filled" ) {
+
+      CrossSectionTable table( std::move( energies ) );
+
+      CHECK( 3 == table.numberEnergies() );
+      CHECK( 0 == table.numberReactions() );
+      CHECK( 3 == table.energies().size() );
+      CHECK( 1e-5 == Approx( table.energies()[0].value ) );
+      CHECK( 1. == Approx( table.energies()[1].value ) );
+      CHECK( 1e+3 == Approx( table.energies()[2].value ) );
+      CHECK( false == table.hasReaction( elas ) );
+      CHECK( false == table.hasReaction( capt ) );
+
+      auto& capture = table.column( capt );
+      CHECK( 3 == capture.size() );
+      capture[0] = 3.;
+      capture[2] = 1.;
+
+      auto& elastic = table.column( elas );
+      CHECK( 3 == elastic.size() );
+      elastic[1] = 2.;
+
+      CHECK( 2 == table.numberReactions() );
+      CHECK( 2 == table.reactions().size() );
+      CHECK( true == table.hasReaction( elas ) );
+      CHECK( true == table.hasReaction( capt ) );
+
+      // requesting an existing column does not add a reaction
+      table.column( capt )[1] = 4.;
+      CHECK( 2 == table.numberReactions() );
+
+      auto values = table.values( elas );
+      CHECK( 3 == values.size() );
+      CHECK( 0. == Approx( values[0] ) );
+      CHECK( 2. == Approx( values[1] ) );
+      CHECK( 0. == Approx( values[2] ) );
+
+      auto xs = table.crossSections( capt );
+      CHECK( 3 == xs.size() );
+      CHECK( 3. == Approx( xs[0].value ) );
+      CHECK( 4. == Approx( xs[1].value ) );
+      CHECK( 1. == Approx( xs[2].value ) );
+
+      auto row = table.crossSections( 1 );
+      CHECK( 2 == row.size() );
+      CHECK( 2. == Approx( row[ elas ].value ) );
+      CHECK( 4. == Approx( row[ capt ].value ) );
+    } // THEN
+
+    THEN( "an exception is thrown when requesting a reaction that is not "
+          "present" ) {
+
+      CrossSectionTable table( std::move( energies ) );
+      table.column( elas );
+
+      CHECK_THROWS( table.values( capt ) );
+      CHECK_THROWS( table.crossSections( capt ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
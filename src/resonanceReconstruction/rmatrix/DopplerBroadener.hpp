@@ -0,0 +1,58 @@
+/**
+ *  @class
+ *  @brief Class used to Doppler broaden linearized cross sections
+ *
+ *  The cross sections are broadened using the exact free gas kernel (the
+ *  SIGMA1 method). With y^2 = alpha E and x^2 = alpha E' (in which
+ *  alpha = A / kT and A the ratio of the target mass to the neutron mass),
+ *  the broadened cross section is given by:
+ *
+ *    sigma*( y ) = 1 / ( y^2 sqrt( pi ) ) int_0^inf x^2 sigma( x )
+ *                    ( exp( - ( x - y )^2 ) - exp( - ( x + y )^2 ) ) dx
+ *
+ *  For cross sections that are linear in energy between the points of the
+ *  energy grid (i.e. linear in x^2), this integral is calculated exactly
+ *  on every interval using the complementary error function. Below the
+ *  first energy of the grid the cross sections are extended as 1/v, above
+ *  the last energy they are extended as a constant.
+ *
+ *  The free gas kernel broadens the reaction rate v sigma( v ) with a
+ *  Maxwellian distribution of the target velocities. Broadening from T1 to
+ *  T2 is therefore the same as broadening the cross sections at T1 with the
+ *  temperature difference T2 - T1, which is used when broadening to
+ *  multiple temperatures.
+ *
+ *  The const member functions of the broadener do not modify the broadener
+ *  and can be called concurrently by multiple threads.
+ */
+class DopplerBroadener {
+
+  /* fields */
+  double awr_;
+
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener/src/tails.hpp"
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener/src/integrate.hpp"
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener/src/convolve.hpp"
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener/src/thin.hpp"
+
+public:
+
+  /**
+   *  @brief The value of | x - y | beyond which the contributions to the
+   *         broadened cross sections are neglected
+   *
+   *  The free gas kernel is smaller than exp( -36 ) beyond this value.
+   */
+  static constexpr double cutoff = 6.;
+
+  /* constructor */
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener/src/ctor.hpp"
+
+  /**
+   *  @brief Return the ratio of the target mass to the neutron mass
+   */
+  double massRatio() const { return this->awr_; }
+
+  #include "resonanceReconstruction/rmatrix/DopplerBroadener/src/broaden.hpp"
+};
@@ -0,0 +1,145 @@
+/**
+ *  @brief Doppler broaden 0 K cross sections to a number of temperatures
+ *
+ *  The cross sections in the table must be given at 0 K on an energy grid on
+ *  which they can be linearly interpolated (e.g. the result of the
+ *  linearize() function of the Reconstructor).
+ *
+ *  The temperatures are processed in increasing order. The cross sections
+ *  at a temperature are obtained by broadening the cross sections at the
+ *  previous temperature (on the thinned grid of that temperature) with the
+ *  temperature difference, so that only the first temperature starts from
+ *  the 0 K grid. For every temperature, the broadened cross sections are
+ *  calculated at the points of the grid of the previous temperature after
+ *  which the grid is thinned: a point is removed when the broadened cross
+ *  section of every reaction can be obtained by linear interpolation within
+ *  the given tolerance, i.e. when for every reaction:
+ *    | sigma( E ) - interpolated | <= max( relative * | sigma( E ) |,
+ *                                        absolute )
+ *  A temperature equal to the previous temperature (or 0 K for the first
+ *  temperature) results in the cross sections of the previous temperature.
+ *
+ *  Since every temperature starts from the thinned grid of the previous
+ *  one, the interpolation errors allowed by the tolerance accumulate over
+ *  the temperatures. Calling this function for every temperature separately
+ *  broadens every temperature from the 0 K grid instead (at a higher cost).
+ *
+ *  The energies of the grid are distributed in tiles over a pool of threads.
+ *  The result is identical to the result of the serial broadening for any
+ *  number of threads.
+ *
+ *  @param[in] table          the 0 K cross sections
+ *  @param[in] temperatures   the temperatures (in increasing order)
+ *  @param[in] relative       the relative tolerance
+ *  @param[in] absolute       the absolute tolerance (in barn)
+ *  @param[in] threads        the number of threads (0 for the number of
+ *                            concurrent threads supported by the hardware)
+ *
+ *  @return the broadened cross sections for every temperature
+ */
+std::vector< CrossSectionTable >
+broaden( const CrossSectionTable& table,
+         const std::vector< Temperature >& temperatures,
+         double relative, double absolute,
+         unsigned int threads ) const {
+
+  std::vector< double > energies;
+  energies.reserve( table.numberEnergies() );
+  for ( const auto& energy : table.energies() ) {
+
+    energies.push_back( energy.value );
+  }
+
+  if ( ( energies.size() == 0 ) or not ( energies.front() > 0. ) or
+       not std::is_sorted( energies.begin(), energies.end() ) ) {
+
+    Log::error( "The energy grid of the cross sections to be broadened must "
+                "be non empty, positive and sorted" );
+    throw std::exception();
+  }
+
+  for ( unsigned int i = 0; i < temperatures.size(); ++i ) {
+
+    const double previous = i > 0 ? temperatures[i - 1].value : 0.;
+    if ( not ( temperatures[i].value >= previous ) ) {
+
+      Log::error( "The temperatures must be positive and given in increasing "
+                  "order" );
+      Log::info( "Found temperature {} K after {} K",
+                 temperatures[i].value, previous );
+      throw std::exception();
+    }
+  }
+
+  std::vector< ReactionID > reactions;
+  std::vector< std::vector< double > > values;
+  for ( const auto& reaction : table.reactions() ) {
+
+    reactions.push_back( reaction );
+    values.push_back( table.values( reaction ) );
+  }
+
+  threads = numberThreads( threads );
+  std::vector< CrossSectionTable > result;
+  result.reserve( temperatures.size() );
+  double previous = 0.;
+  for ( const auto& temperature : temperatures ) {
+
+    if ( temperature.value > previous ) {
+
+      const double alpha = this->massRatio()
+                           / ( boltzmann.value
+                               * ( temperature.value - previous ) );
+      values = convolve( energies, values, alpha, threads );
+
+      const auto kept = thin( energies, values, relative, absolute );
+      for ( unsigned int i = 0; i < kept.size(); ++i ) {
+
+        energies[i] = energies[ kept[i] ];
+        for ( auto& sigma : values ) {
+
+          sigma[i] = sigma[ kept[i] ];
+        }
+      }
+      energies.resize( kept.size() );
+      for ( auto& sigma : values ) {
+
+        sigma.resize( kept.size() );
+      }
+    }
+    previous = temperature.value;
+
+    std::vector< Energy > grid;
+    grid.reserve( energies.size() );
+    for ( const auto energy : energies ) {
+
+      grid.push_back( energy * electronVolt );
+    }
+    CrossSectionTable broadened( std::move( grid ) );
+    for ( unsigned int slot = 0; slot < reactions.size(); ++slot ) {
+
+      broadened.column( reactions[ slot ] ) = values[ slot ];
+    }
+    result.push_back( std::move( broadened ) );
+  }
+  return result;
+}
+
+/**
+ *  @brief Doppler broaden 0 K cross sections to a number of temperatures
+ *
+ *  See the broaden() function using multiple threads for more information.
+ *  This function uses a single thread.
+ *
+ *  @param[in] table          the 0 K cross sections
+ *  @param[in] temperatures   the temperatures (in increasing order)
+ *  @param[in] relative       the relative tolerance
+ *  @param[in] absolute       the absolute tolerance (in barn)
+ */
+std::vector< CrossSectionTable >
+broaden( const CrossSectionTable& table,
+         const std::vector< Temperature >& temperatures,
+         double relative, double absolute ) const {
+
+  return this->broaden( table, temperatures, relative, absolute, 1 );
+}
@@ -0,0 +1,118 @@
+/**
+ *  @brief Broaden cross sections with the free gas kernel on their own
+ *         energy grid
+ *
+ *  The cross sections are linear in x^2 on every interval of the grid:
+ *    sigma( x ) = a + b x^2
+ *  so that the contribution of a piece of an interval to the broadened cross
+ *  section only requires the moments M_2 and M_4 of the free gas kernel
+ *  over that piece (see integrate()). These moments only depend on the
+ *  grid and are therefore calculated once for all reactions. The 1/v
+ *  extension below the first point of the grid requires M_1, the constant
+ *  extension above the last point M_2.
+ *
+ *  The energies of the grid are distributed in tiles over a pool of threads.
+ *  Every broadened value is calculated independently of the thread
+ *  calculating it, so the result is identical for any number of threads.
+ *
+ *  @param[in] energies   the energy grid (in eV)
+ *  @param[in] values     the cross section values (in barn) for every
+ *                        reaction
+ *  @param[in] alpha      the ratio of the target mass to kT (in 1/eV)
+ *  @param[in] threads    the number of threads (at least 1)
+ *
+ *  @return the broadened cross section values (in barn) for every reaction
+ */
+static std::vector< std::vector< double > >
+convolve( const std::vector< double >& energies,
+          const std::vector< std::vector< double > >& values,
+          double alpha, unsigned int threads ) {
+
+  const unsigned int number = energies.size();
+  const unsigned int size = values.size();
+  const int last = number - 1;
+
+  // the grid as x values and the coefficients of sigma = a + b x^2 on every
+  // interval of the grid (size coefficients for every interval)
+  std::vector< double > x( number );
+  std::vector< double > a( last * size );
+  std::vector< double > b( last * size );
+  for ( unsigned int i = 0; i < number; ++i ) {
+
+    x[i] = std::sqrt( alpha * energies[i] );
+  }
+  for ( int i = 0; i < last; ++i ) {
+
+    const double width = energies[i + 1] - energies[i];
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      const auto& sigma = values[ slot ];
+      const double slope = width > 0. ? ( sigma[i + 1] - sigma[i] ) / width
+                                      : 0.;
+      a[ i * size + slot ] = sigma[i] - slope * energies[i];
+      b[ i * size + slot ] = slope / alpha;
+    }
+  }
+
+  std::vector< std::vector< double > > result(
+      size, std::vector< double >( number, 0. ) );
+  std::vector< std::vector< double > > sums(
+      threads, std::vector< double >( size ) );
+  parallelFor( 0, number, CrossSectionTable::tileSize, threads,
+               [&] ( unsigned int thread,
+                     unsigned int first, unsigned int end ) {
+
+                 auto& sum = sums[ thread ];
+                 auto add = [&] ( double sign, int segment,
+                                  const std::array< double, 5 >& m ) {
+
+                   if ( segment < 0 ) {
+
+                     for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+                       sum[ slot ] += sign * values[ slot ][0] * x[0] * m[1];
+                     }
+                   }
+                   else if ( segment == last ) {
+
+                     for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+                       sum[ slot ] += sign * values[ slot ][ last ] * m[2];
+                     }
+                   }
+                   else {
+
+                     const double* ai = a.data() + segment * size;
+                     const double* bi = b.data() + segment * size;
+                     for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+                       sum[ slot ] += sign * ( ai[ slot ] * m[2]
+                                               + bi[ slot ] * m[4] );
+                     }
+                   }
+                 };
+
+                 for ( unsigned int i = first; i < end; ++i ) {
+
+                   // exp( - ( x - y )^2 ) contributes for | x - y | < cutoff
+                   // and exp( - ( x + y )^2 ) only for x + y < cutoff
+                   const double y = x[i];
+                   std::fill( sum.begin(), sum.end(), 0. );
+                   integrate( x, std::max( 0., y - cutoff ), y + cutoff, y,
+                              [&] ( int segment, const auto& m )
+                                  { add( 1., segment, m ); } );
+                   if ( y < cutoff ) {
+
+                     integrate( x, 0., cutoff - y, -y,
+                                [&] ( int segment, const auto& m )
+                                    { add( -1., segment, m ); } );
+                   }
+
+                   for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+                     result[ slot ][i] = sum[ slot ] / ( y * y );
+                   }
+                 }
+               } );
+  return result;
+}
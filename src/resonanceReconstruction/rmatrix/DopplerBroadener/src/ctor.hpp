@@ -0,0 +1,14 @@
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] awr   the ratio of the target mass to the neutron mass
+ */
+DopplerBroadener( double awr ) : awr_( awr ) {
+
+  if ( not ( awr > 0. ) ) {
+
+    Log::error( "The mass ratio of the target must be positive" );
+    Log::info( "Found mass ratio: {}", awr );
+    throw std::exception();
+  }
+}
@@ -0,0 +1,62 @@
+/**
+ *  @brief Calculate the moments of the free gas kernel over the pieces of an
+ *         interval
+ *
+ *  The interval [lower, upper] is split into pieces at the points of the
+ *  grid (given as x = sqrt( alpha E ) values in increasing order). For every
+ *  piece, the moments
+ *    M_n = 1 / sqrt( pi ) int x^n exp( - ( x - centre )^2 ) dx
+ *  are calculated for n = 0 to 4 by expanding x^n = ( z + centre )^n in the
+ *  Gaussian moments of z = x - centre (see moments()). The tail integrals at
+ *  a point of the grid are shared by the two pieces adjacent to it.
+ *
+ *  The function is called as function( segment, moments ) for every piece,
+ *  in which segment is the index of the interval of the grid containing the
+ *  piece (-1 for a piece below the first point and the number of points - 1
+ *  for a piece above the last point).
+ *
+ *  @param[in] x          the grid (as x values)
+ *  @param[in] lower      the lower boundary of the interval
+ *  @param[in] upper      the upper boundary of the interval
+ *  @param[in] centre     the centre of the Gaussian
+ *  @param[in] function   the function receiving the moments of every piece
+ */
+template < typename Function >
+static void integrate( const std::vector< double >& x,
+                       double lower, double upper, double centre,
+                       Function&& function ) {
+
+  const double t = centre;
+  const double t2 = t * t;
+  auto iter = std::upper_bound( x.begin(), x.end(), lower );
+  int segment = std::distance( x.begin(), iter ) - 1;
+
+  double left = lower;
+  auto previous = tails( left - centre );
+  while ( left < upper ) {
+
+    const double right = iter != x.end() ? std::min( *iter, upper ) : upper;
+    const auto current = tails( right - centre );
+    if ( right > left ) {
+
+      const auto h = moments( left - centre, previous,
+                              right - centre, current );
+      const std::array< double, 5 > m = {{
+          h[0],
+          h[1] + t * h[0],
+          h[2] + 2. * t * h[1] + t2 * h[0],
+          h[3] + 3. * t * h[2] + 3. * t2 * h[1] + t * t2 * h[0],
+          h[4] + 4. * t * h[3] + 6. * t2 * h[2] + 4. * t * t2 * h[1]
+               + t2 * t2 * h[0] }};
+      function( segment, m );
+    }
+
+    left = right;
+    previous = current;
+    if ( iter != x.end() ) {
+
+      ++iter;
+      ++segment;
+    }
+  }
+}
@@ -0,0 +1,62 @@
+/**
+ *  @brief Calculate the tail integrals of the Gaussian moments
+ *
+ *  The tail integrals F_n( a ) = 1 / sqrt( pi ) int_a^inf z^n exp( -z^2 ) dz
+ *  are calculated for n = 0 to 4 using the recursion relation:
+ *    F_n( a ) = ( n - 1 ) / 2 F_n-2( a ) + a^( n - 1 ) F_1( a )
+ *  with F_0( a ) = erfc( a ) / 2 and F_1( a ) = exp( -a^2 ) / ( 2 sqrt( pi ) ).
+ *  The tail integrals are calculated for | a | so that they are always
+ *  obtained from the small tail of the complementary error function.
+ *
+ *  @param[in] a   the lower boundary of the tail integrals
+ */
+static std::array< double, 5 > tails( double a ) {
+
+  a = std::abs( a );
+  const double f0 = 0.5 * std::erfc( a );
+  const double f1 = 0.5 / std::sqrt( pi ) * std::exp( - a * a );
+  const double f2 = 0.5 * f0 + a * f1;
+  return {{ f0, f1, f2, ( 1. + a * a ) * f1, 1.5 * f2 + a * a * a * f1 }};
+}
+
+/**
+ *  @brief Calculate the Gaussian moments over an interval
+ *
+ *  The moments H_n( a, b ) = 1 / sqrt( pi ) int_a^b z^n exp( -z^2 ) dz are
+ *  calculated for n = 0 to 4 from the tail integrals at | a | and | b | (see
+ *  tails()), using the symmetry of the Gaussian for negative boundaries to
+ *  avoid the cancellation of two tail integrals close to 1.
+ *
+ *  @param[in] a       the lower boundary of the interval
+ *  @param[in] lower   the tail integrals at | a |
+ *  @param[in] b       the upper boundary of the interval
+ *  @param[in] upper   the tail integrals at | b |
+ */
+static std::array< double, 5 > moments( double a,
+                                        const std::array< double, 5 >& lower,
+                                        double b,
+                                        const std::array< double, 5 >& upper ) {
+
+  // the tail integrals at zero
+  constexpr double f1 = 0.28209479177387814; // 1 / ( 2 sqrt( pi ) )
+  constexpr std::array< double, 5 > zero = {{ 0.5, f1, 0.25, f1, 0.375 }};
+
+  std::array< double, 5 > result;
+  for ( unsigned int n = 0; n < 5; ++n ) {
+
+    const double sign = n % 2 == 0 ? 1. : -1.;
+    if ( a >= 0. ) {
+
+      result[n] = lower[n] - upper[n];
+    }
+    else if ( b <= 0. ) {
+
+      result[n] = sign * ( upper[n] - lower[n] );
+    }
+    else {
+
+      result[n] = sign * ( zero[n] - lower[n] ) + zero[n] - upper[n];
+    }
+  }
+  return result;
+}
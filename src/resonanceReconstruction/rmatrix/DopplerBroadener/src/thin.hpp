@@ -0,0 +1,95 @@
+/**
+ *  @brief Thin an energy grid on which cross sections can be linearly
+ *         interpolated
+ *
+ *  A point of the grid is removed when the cross sections of every reaction
+ *  can be obtained by linear interpolation between the remaining points
+ *  within the given tolerance, i.e. when for every reaction:
+ *    | sigma( E ) - interpolated | <= max( relative * | sigma( E ) |,
+ *                                        absolute )
+ *
+ *  Starting from a point that is kept, the grid is traversed while keeping
+ *  track of the range of slopes for which every point that was passed is
+ *  within the tolerance. The previous point is kept as soon as the line
+ *  towards the next point no longer falls within that range, so that every
+ *  point is only visited once. The first and last points of the grid and
+ *  both points of a discontinuity are always kept.
+ *
+ *  @param[in] energies   the energy grid (in eV)
+ *  @param[in] values     the cross section values (in barn) for every
+ *                        reaction
+ *  @param[in] relative   the relative tolerance
+ *  @param[in] absolute   the absolute tolerance (in barn)
+ *
+ *  @return the indices of the points that are kept
+ */
+static std::vector< unsigned int >
+thin( const std::vector< double >& energies,
+      const std::vector< std::vector< double > >& values,
+      double relative, double absolute ) {
+
+  const unsigned int number = energies.size();
+  const unsigned int size = values.size();
+  constexpr double infinity = std::numeric_limits< double >::infinity();
+
+  std::vector< unsigned int > kept( 1, 0 );
+  std::vector< double > lowest( size, -infinity );
+  std::vector< double > highest( size, infinity );
+  auto keep = [&] ( unsigned int i ) {
+
+    kept.push_back( i );
+    std::fill( lowest.begin(), lowest.end(), -infinity );
+    std::fill( highest.begin(), highest.end(), infinity );
+  };
+
+  unsigned int i = 1;
+  while ( i < number ) {
+
+    const unsigned int anchor = kept.back();
+    const double width = energies[i] - energies[ anchor ];
+    if ( width <= 0. ) {
+
+      // a discontinuity
+      keep( i );
+      ++i;
+      continue;
+    }
+
+    bool accept = true;
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      const auto& sigma = values[ slot ];
+      const double slope = ( sigma[i] - sigma[ anchor ] ) / width;
+      accept = accept and ( lowest[ slot ] <= slope ) and
+               ( slope <= highest[ slot ] );
+    }
+
+    if ( ( not accept ) and ( anchor + 1 < i ) ) {
+
+      // the previous point is kept, the current point is processed again
+      keep( i - 1 );
+      continue;
+    }
+
+    // restrict the range of slopes using the current point
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      const auto& sigma = values[ slot ];
+      const double tolerance = std::max( relative * std::abs( sigma[i] ),
+                                         absolute );
+      lowest[ slot ] = std::max( lowest[ slot ],
+                                 ( sigma[i] - tolerance - sigma[ anchor ] )
+                                   / width );
+      highest[ slot ] = std::min( highest[ slot ],
+                                  ( sigma[i] + tolerance - sigma[ anchor ] )
+                                    / width );
+    }
+    ++i;
+  }
+
+  if ( kept.back() != number - 1 ) {
+
+    kept.push_back( number - 1 );
+  }
+  return kept;
+}
@@ -0,0 +1,123 @@
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+// convenience typedefs
+using CrossSectionTable = rmatrix::CrossSectionTable;
+using DopplerBroadener = rmatrix::DopplerBroadener;
+using ReactionID = rmatrix::ReactionID;
+
+SCENARIO( "DopplerBroadener" ) {
+
+  GIVEN( "0 K cross sections on a linearized energy grid" ) {
+
+    // a 1/v capture cross section and a constant elastic cross section
+    std::vector< Energy > energies;
+    for ( double energy = 1e-5; energy < 1e+3; energy *= 1.005 ) {
+
+      energies.push_back( energy * electronVolt );
+    }
+
+    ReactionID elas( "n,Fe54->n,Fe54" );
+    ReactionID capt( "n,Fe54->capture" );
+
+    CrossSectionTable table( std::move( energies ) );
+    auto& elastic = table.column( elas );
+    auto& capture = table.column( capt );
+    for ( unsigned int i = 0; i < table.numberEnergies(); ++i ) {
+
+      elastic[i] = 10.;
+      capture[i] = 5. / std::sqrt( table.energies()[i].value );
+    }
+
+    DopplerBroadener broadener( 10. );
+
+    THEN( "the cross sections can be broadened to multiple temperatures" ) {
+
+      const std::vector< Temperature > temperatures = { 0. * kelvin,
+                                                        300. * kelvin,
+                                                        600. * kelvin };
+      auto broadened = broadener.broaden( table, temperatures, 1e-4, 1e-8 );
+
+      CHECK( 10. == Approx( broadener.massRatio() ) );
+      CHECK( 3 == broadened.size() );
+
+      // 0 K: the cross sections are unchanged
+      CHECK( table.numberEnergies() == broadened[0].numberEnergies() );
+      CHECK( table.values( elas ) == broadened[0].values( elas ) );
+      CHECK( table.values( capt ) == broadened[0].values( capt ) );
+
+      // the grids are thinned
+      CHECK( broadened[1].numberEnergies() < table.numberEnergies() );
+      CHECK( broadened[2].numberEnergies() <= broadened[1].numberEnergies() );
+
+      for ( unsigned int t = 1; t < 3; ++t ) {
+
+        const auto& result = broadened[t];
+        const double alpha = broadener.massRatio()
+                             / ( boltzmann.value * temperatures[t].value );
+
+        CHECK( 2 == result.numberReactions() );
+        CHECK( 1e-5 == Approx( result.energies().front().value ) );
+
+        for ( unsigned int i = 0; i < result.numberEnergies(); ++i ) {
+
+          const double energy = result.energies()[i].value;
+          if ( energy < 500. ) {
+
+            // the free gas kernel preserves 1/v cross sections
+            CHECK( 5. / std::sqrt( energy ) ==
+                   Approx( result.values( capt )[i] ).epsilon( 1e-3 ) );
+
+            // a constant cross section is broadened analytically
+            const double y = std::sqrt( alpha * energy );
+            const double expected =
+                10. * ( ( 1. + 0.5 / ( y * y ) ) * std::erf( y )
+                        + std::exp( - y * y ) / ( y * std::sqrt( pi ) ) );
+            CHECK( expected ==
+                   Approx( result.values( elas )[i] ).epsilon( 1e-3 ) );
+          }
+        }
+      }
+    } // THEN
+
+    THEN( "the result is the same for any number of threads" ) {
+
+      const std::vector< Temperature > temperatures = { 300. * kelvin,
+                                                        1200. * kelvin };
+      auto serial = broadener.broaden( table, temperatures, 1e-3, 1e-8 );
+      for ( unsigned int threads : { 2u, 4u, 0u } ) {
+
+        auto parallel = broadener.broaden( table, temperatures,
+                                           1e-3, 1e-8, threads );
+        for ( unsigned int t = 0; t < 2; ++t ) {
+
+          CHECK( serial[t].numberEnergies() == parallel[t].numberEnergies() );
+          CHECK( serial[t].values( elas ) == parallel[t].values( elas ) );
+          CHECK( serial[t].values( capt ) == parallel[t].values( capt ) );
+        }
+      }
+    } // THEN
+
+    THEN( "an exception is thrown for temperatures that are not in "
+          "increasing order" ) {
+
+      CHECK_THROWS( broadener.broaden( table, { 600. * kelvin, 300. * kelvin },
+                                       1e-3, 1e-8 ) );
+      CHECK_THROWS( broadener.broaden( table, { -300. * kelvin },
+                                       1e-3, 1e-8 ) );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "invalid data for a DopplerBroadener" ) {
+
+    THEN( "an exception is thrown for a mass ratio that is not positive" ) {
+
+      CHECK_THROWS( DopplerBroadener( 0. ) );
+      CHECK_THROWS( DopplerBroadener( -1. ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
@@ -0,0 +1,46 @@
+/**
+ *  @class
+ *  @brief Scratch data used during the evaluation of a compound system
+ *
+ *  The evaluation workspace contains a spin group workspace for each spin
+ *  group in a compound system. A workspace for a given compound system should
+ *  be obtained from the workspace() function of that compound system (or of
+ *  the Reconstructor).
+ *
+ *  The compound system itself is not modified during evaluation: a single
+ *  compound system can be shared by multiple threads as long as every thread
+ *  uses its own evaluation workspace.
+ */
+class EvaluationWorkspace {
+
+  /* fields */
+  std::vector< SpinGroupWorkspace > groups_;
+
+public:
+
+  /* constructor */
+  EvaluationWorkspace() = default;
+
+  /**
+   *  @brief Constructor
+   *
+   *  @param[in] groups   the workspaces for each spin group
+   */
+  EvaluationWorkspace( std::vector< SpinGroupWorkspace >&& groups ) :
+    groups_( std::move( groups ) ) {}
+
+  /**
+   *  @brief Return the number of spin group workspaces
+   */
+  unsigned int numberSpinGroups() const { return this->groups_.size(); }
+
+  /**
+   *  @brief Return the workspace for a given spin group
+   *
+   *  @param[in] index   the index of the spin group
+   */
+  SpinGroupWorkspace& spinGroup( unsigned int index ) {
+
+    return this->groups_[ index ];
+  }
+};
@@ -13,6 +13,14 @@ class LMatrixCalculator< Constant > {
 
 public:
 
+  /**
+   *  @brief Default constructor
+   *
+   *  A default constructed calculator can only be used with an external
+   *  L matrix.
+   */
+  LMatrixCalculator() = default;
+
   /**
    *  @brief Constructor
    *
@@ -31,4 +39,5 @@ public:
   matrix() const { return this->lmatrix_; }
 
   #include "resonanceReconstruction/rmatrix/LMatrixCalculator/Constant/src/call.hpp"
+  #include "resonanceReconstruction/rmatrix/LMatrixCalculator/Constant/src/derivative.hpp"
 };
@@ -4,6 +4,7 @@
  *  @param[in] energy            the energy value
  *  @param[in] penetrabilities   the channel penetrabilities
  *  @param[in] channels          the channels
+ *  @param[in,out] lmatrix       the diagonal L matrix to be calculated
  *
  *  @return The resulting L = S - B + iP matrix
  */
@@ -11,7 +12,8 @@ template < typename Penetrabilities, typename Channels >
 const DiagonalMatrix< std::complex< double > >&
 operator()( const Energy& energy,
             const Penetrabilities& penetrabilities,
-            const Channels& channels ) {
+            const Channels& channels,
+            DiagonalMatrix< std::complex< double > >& lmatrix ) const {
 
   auto shiftMinusBoundary = [&] ( const auto& channel )
                                 { return channel.shiftFactor( energy ) -
@@ -27,10 +29,58 @@ operator()( const Energy& energy,
                                                           channel ); } ),
                     penetrabilities );
 
-  this->lmatrix_.setZero();
+  lmatrix.resize( diagonal.size() );
   for ( unsigned int i = 0; i < diagonal.size(); ++i ) {
 
-    this->lmatrix_.diagonal()[i] = diagonal[i];
+    lmatrix.diagonal()[i] = diagonal[i];
+  }
+  return lmatrix;
+}
+
+/**
+ *  @brief Diagonal L matrix calculation for the Constant boundary condition
+ *
+ *  @param[in] energy            the energy value
+ *  @param[in] penetrabilities   the channel penetrabilities
+ *  @param[in] channels          the channels
+ *
+ *  @return The resulting L = S - B + iP matrix
+ */
+template < typename Penetrabilities, typename Channels >
+const DiagonalMatrix< std::complex< double > >&
+operator()( const Energy& energy,
+            const Penetrabilities& penetrabilities,
+            const Channels& channels ) {
+
+  return ( *this )( energy, penetrabilities, channels, this->lmatrix_ );
+}
+
+/**
+ *  @brief Diagonal L matrix calculation for the Constant boundary condition
+ *         using the channel states at the current energy
+ *
+ *  @param[in] states        the channel states at the current energy
+ *  @param[in] channels      the channels
+ *  @param[in,out] lmatrix   the diagonal L matrix to be calculated
+ *
+ *  @return The resulting L = S - B + iP matrix
+ */
+template < typename Channels >
+const DiagonalMatrix< std::complex< double > >&
+operator()( const std::vector< ChannelState >& states,
+            const Channels& channels,
+            DiagonalMatrix< std::complex< double > >& lmatrix ) const {
+
+  auto boundary = [] ( const auto& channel )
+                     { return channel.boundaryCondition(); };
+
+  lmatrix.resize( states.size() );
+  for ( unsigned int i = 0; i < states.size(); ++i ) {
+
+    lmatrix.diagonal()[i] =
+        std::complex< double >(
+            states[i].shiftFactor - std::visit( boundary, channels[i] ),
+            states[i].penetrability );
   }
-  return this->lmatrix_;
+  return lmatrix;
 }
@@ -19,6 +19,7 @@ using ChannelID = rmatrix::ChannelID;
 using ChannelQuantumNumbers = rmatrix::ChannelQuantumNumbers;
 using ChannelRadii = rmatrix::ChannelRadii;
 using BoundaryCondition = rmatrix::BoundaryCondition;
+using ChannelState = rmatrix::ChannelState;
 
 constexpr ElectricalCharge elementary = dimwits::constant::elementaryCharge;
 
@@ -99,6 +100,62 @@ SCENARIO( "LMatrixCalculator< Constant >" ) {
       CHECK( std::complex< double >( 2., 2. ) == matrix.diagonal()[1] );
       CHECK( std::complex< double >( 1., 3. ) == matrix.diagonal()[2] );
     }
+
+    THEN( "L = S - B + iP can be calculated using an external matrix" ) {
+
+      const LMatrixCalculator< Constant > calculator;
+      rmatrix::DiagonalMatrix< std::complex< double > > matrix;
+
+      calculator( energy, penetrabilities, channels, matrix );
+
+      CHECK( 3 == matrix.diagonal().size() );
+      CHECK( std::complex< double >( 3., 1. ) == matrix.diagonal()[0] );
+      CHECK( std::complex< double >( 2., 2. ) == matrix.diagonal()[1] );
+      CHECK( std::complex< double >( 1., 3. ) == matrix.diagonal()[2] );
+    }
+
+    THEN( "L can be calculated using the channel states" ) {
+
+      const LMatrixCalculator< Constant > calculator;
+      rmatrix::DiagonalMatrix< std::complex< double > > matrix;
+
+      std::vector< ChannelState > states;
+      for ( const auto& channel : channels ) {
+
+        states.push_back(
+          std::visit( [&] ( const auto& channel )
+                          { return ChannelState{
+                                     channel.waveNumber( energy ),
+                                     0., 0., 0., 0.,
+                                     channel.penetrability( energy ),
+                                     channel.shiftFactor( energy ),
+                                     0., 0., false }; },
+                      channel ) );
+      }
+
+      calculator( states, channels, matrix );
+
+      CHECK( 3 == matrix.diagonal().size() );
+      CHECK( std::complex< double >( 3., 1. ) == matrix.diagonal()[0] );
+      CHECK( std::complex< double >( 2., 2. ) == matrix.diagonal()[1] );
+      CHECK( std::complex< double >( 1., 3. ) == matrix.diagonal()[2] );
+    }
+
+    THEN( "the derivative of L can be calculated" ) {
+
+      const LMatrixCalculator< Constant > calculator;
+      rmatrix::DiagonalMatrix< std::complex< double > > matrix;
+
+      std::vector< std::array< double, 3 > > derivatives =
+        { {{ 1., 4., 7. }}, {{ 2., 5., 8. }}, {{ 3., 6., 9. }} };
+
+      calculator.derivative( derivatives, channels, matrix );
+
+      CHECK( 3 == matrix.diagonal().size() );
+      CHECK( std::complex< double >( 4., 1. ) == matrix.diagonal()[0] );
+      CHECK( std::complex< double >( 5., 2. ) == matrix.diagonal()[1] );
+      CHECK( std::complex< double >( 6., 3. ) == matrix.diagonal()[2] );
+    }
   } // GIVEN
 } // SCENARIO
 
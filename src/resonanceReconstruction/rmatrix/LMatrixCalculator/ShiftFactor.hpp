@@ -22,6 +22,14 @@ class LMatrixCalculator< ShiftFactor > {
 
 public:
 
+  /**
+   *  @brief Default constructor
+   *
+   *  A default constructed calculator can only be used with an external
+   *  L matrix.
+   */
+  LMatrixCalculator() = default;
+
   /**
    *  @brief Constructor
    *
@@ -40,4 +48,5 @@ public:
   matrix() const { return this->lmatrix_; }
 
   #include "resonanceReconstruction/rmatrix/LMatrixCalculator/ShiftFactor/src/call.hpp"
+  #include "resonanceReconstruction/rmatrix/LMatrixCalculator/ShiftFactor/src/derivative.hpp"
 };
@@ -1,23 +1,68 @@
 /**
- *  @brief Diagonal L matrix calculation for the Constant boundary condition
+ *  @brief Diagonal L matrix calculation for the ShiftFactor boundary condition
  *
  *  @param[in] energy            the energy value
  *  @param[in] penetrabilities   the channel penetrabilities
  *  @param[in] channels          the channels
+ *  @param[in,out] lmatrix       the diagonal L matrix to be calculated
  *
- *  @return The resulting L = S - B + iP matrix
+ *  @return The resulting L = iP matrix
  */
 template < typename Penetrabilities, typename Channels >
 const DiagonalMatrix< std::complex< double > >&
 operator()( const Energy&,
             const Penetrabilities& penetrabilities,
-            const Channels& ) {
+            const Channels&,
+            DiagonalMatrix< std::complex< double > >& lmatrix ) const {
 
-  this->lmatrix_.setZero();
+  lmatrix.resize( penetrabilities.size() );
   for ( unsigned int i = 0; i < penetrabilities.size(); ++i ) {
 
-    this->lmatrix_.diagonal()[i] =
+    lmatrix.diagonal()[i] =
         std::complex< double >( 0.0, penetrabilities[i] );
   }
-  return this->lmatrix_;
+  return lmatrix;
+}
+
+/**
+ *  @brief Diagonal L matrix calculation for the ShiftFactor boundary condition
+ *
+ *  @param[in] energy            the energy value
+ *  @param[in] penetrabilities   the channel penetrabilities
+ *  @param[in] channels          the channels
+ *
+ *  @return The resulting L = iP matrix
+ */
+template < typename Penetrabilities, typename Channels >
+const DiagonalMatrix< std::complex< double > >&
+operator()( const Energy& energy,
+            const Penetrabilities& penetrabilities,
+            const Channels& channels ) {
+
+  return ( *this )( energy, penetrabilities, channels, this->lmatrix_ );
+}
+
+/**
+ *  @brief Diagonal L matrix calculation for the ShiftFactor boundary condition
+ *         using the channel states at the current energy
+ *
+ *  @param[in] states        the channel states at the current energy
+ *  @param[in] channels      the channels
+ *  @param[in,out] lmatrix   the diagonal L matrix to be calculated
+ *
+ *  @return The resulting L = iP matrix
+ */
+template < typename Channels >
+const DiagonalMatrix< std::complex< double > >&
+operator()( const std::vector< ChannelState >& states,
+            const Channels&,
+            DiagonalMatrix< std::complex< double > >& lmatrix ) const {
+
+  lmatrix.resize( states.size() );
+  for ( unsigned int i = 0; i < states.size(); ++i ) {
+
+    lmatrix.diagonal()[i] =
+        std::complex< double >( 0.0, states[i].penetrability );
+  }
+  return lmatrix;
 }
@@ -0,0 +1,27 @@
+/**
+ *  @brief Diagonal L matrix derivative calculation for the ShiftFactor
+ *         boundary condition
+ *
+ *  @param[in] derivatives     the derivatives of the penetrability, shift
+ *                             factor and phase shift of each channel (see
+ *                             Channel::derivatives())
+ *  @param[in] channels        the channels
+ *  @param[in,out] lmatrix     the diagonal L matrix derivative to be
+ *                             calculated
+ *
+ *  @return The resulting dL/dE = i dP/dE matrix
+ */
+template < typename Channels >
+const DiagonalMatrix< std::complex< double > >&
+derivative( const std::vector< std::array< double, 3 > >& derivatives,
+            const Channels&,
+            DiagonalMatrix< std::complex< double > >& lmatrix ) const {
+
+  lmatrix.resize( derivatives.size() );
+  for ( unsigned int i = 0; i < derivatives.size(); ++i ) {
+
+    lmatrix.diagonal()[i] =
+        std::complex< double >( 0.0, derivatives[i][0] );
+  }
+  return lmatrix;
+}
@@ -2,32 +2,101 @@
  *  @class
  *  @brief A functor to calculate the ( I - RL )^-1 R matrix using the
  *         Reich-Moore approximation
+ *
+ *  The calculator does not store any intermediate results: the R, L and
+ *  ( I - RL )^-1 R matrices are stored in the spin group workspace given by
+ *  the caller.
+ *
+ *  Since R and ( I - RL )^-1 R are symmetric, column c of ( I - RL )^-1 R
+ *  is also its row c. When only a number of rows are required (e.g. the ones
+ *  for the incident channels), only the corresponding columns are calculated.
+ *
+ *  For spin groups with 1 to 4 channels, the ( I - RL )^-1 R matrix is
+ *  calculated using fixed size matrices. The calculation to be used is
+ *  selected at construction using the number of channels.
+ *
+ *  Channels below threshold do not contribute: their rows and columns in the
+ *  ( I - RL )^-1 R matrix are zero. When some channels are closed, only the
+ *  R and L matrices of the open channels are calculated and the open channel
+ *  system is solved (using the calculation for the number of open channels),
+ *  after which the result is scattered into the full size matrix.
+ *
+ *  In the same way, channels that are not coupled by any resonance give rise
+ *  to a block diagonal R matrix. The independent channel blocks and the
+ *  channels without any width (which behave like closed channels) are
+ *  determined at construction using the reduced widths in the resonance table,
+ *  after which every block is solved separately.
+ *
+ *  Alternatively, the ( I - RL )^-1 R matrix can be calculated using the
+ *  level matrix, which is a matrix with a row and column for every resonance
+ *  instead of every channel. By default, the calculation expected to be the
+ *  cheapest for the number of resonances and channels is selected at
+ *  construction but this choice can be overridden by passing ChannelMatrix or
+ *  LevelMatrix to the constructor.
+ *
+ *  The derivative of the ( I - RL )^-1 R matrix with respect to the energy
+ *  can be calculated from the complete ( I - RL )^-1 R matrix (see
+ *  derivative()).
  */
 template < typename BoundaryOption >
 class RLMatrixCalculator< ReichMoore, BoundaryOption > {
 
+  /* type aliases */
+  using Solver = void (*)( const Matrix< std::complex< double > >&,
+                           const DiagonalMatrix< std::complex< double > >&,
+                           const std::vector< unsigned int >&,
+                           SpinGroupWorkspace&,
+                           Matrix< std::complex< double > >& );
+
   /* fields */
   LMatrixCalculator< BoundaryOption > lmatrix_;
-  Matrix< std::complex< double > > rmatrix_;
-  Matrix< std::complex< double > > rlmatrix_;
+  Solver solve_;
+  std::vector< unsigned int > order_;
+  std::vector< unsigned int > bounds_;
+  bool coupled_;
+  bool level_;
+  Matrix< double > widths_;
 
-public:
+protected:
+
+  /* auxiliary functions - ( I - RL )^-1 R solvers */
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/solve.hpp"
+
+private:
+
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/makeBlocks.hpp"
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/makeWidths.hpp"
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/isLevelMatrixCheaper.hpp"
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/assemble.hpp"
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/solveLevelMatrix.hpp"
 
   /**
-   *  @brief Constructor
+   *  @brief Private constructor
    *
-   *  @param[in] table   the resonance table
+   *  @param[in] table   the resonance table of the spin group
+   *  @param[in] level   whether or not to use the level matrix calculation
    */
-  RLMatrixCalculator( const ResonanceTable& table ) :
-    lmatrix_( table.numberChannels() ),
-    rmatrix_( table.numberChannels(), table.numberChannels() ),
-    rlmatrix_( table.numberChannels(), table.numberChannels() ) {};
+  RLMatrixCalculator( const ResonanceTable& table, bool level ) :
+    solve_( makeSolver( table.numberChannels() ) ),
+    level_( level ),
+    widths_( level ? makeWidths( table ) : Matrix< double >() ) {
+
+    makeBlocks( table, this->order_, this->bounds_ );
+    this->coupled_ = ( this->bounds_.size() == 2 ) &&
+                     ( this->order_.size() == table.numberChannels() );
+  }
+
+public:
+
+  /* constructor */
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/ctor.hpp"
 
   /**
-   *  @brief Return the ( I - RL )^-1 R matrix
+   *  @brief Return whether or not the level matrix calculation is used
    */
-  const Matrix< std::complex< double > >&
-  matrix() const { return this->lmatrix_; }
+  bool usesLevelMatrix() const { return this->level_; }
 
   #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/call.hpp"
+  #include "resonanceReconstruction/rmatrix/RLMatrixCalculator/ReichMoore/src/derivative.hpp"
 };
@@ -0,0 +1,113 @@
+/**
+ *  @brief Calculate the R and L matrices
+ *
+ *  Only the coupled channels above threshold are included in the R matrix:
+ *  the R matrix is calculated for the open channels (in the order given by
+ *  workspace.open, i.e. grouped per channel block) while the L matrix is
+ *  calculated for all channels. Only the diagonal blocks of the R matrix are
+ *  calculated since the elements coupling different blocks are zero.
+ *
+ *  @param[in] energy            the energy value
+ *  @param[in] table             the resonance table
+ *  @param[in] states            the channel states at the current energy
+ *  @param[in] channels          the channels
+ *  @param[in,out] workspace     the workspace in which the R and L matrices
+ *                               are stored
+ */
+template < typename Channels >
+void assemble( const Energy& energy,
+               const ResonanceTable& table,
+               const std::vector< ChannelState >& states,
+               const Channels& channels,
+               SpinGroupWorkspace& workspace ) const {
+
+  auto& rmatrix = workspace.rmatrix;
+
+  // the coupled channels above threshold grouped per channel block, and the
+  // end of each (non empty) block in the list of open channels
+  auto& open = workspace.open;
+  auto& blocks = workspace.blocks;
+  open.clear();
+  blocks.clear();
+  for ( unsigned int b = 0; b + 1 < this->bounds_.size(); ++b ) {
+
+    for ( unsigned int i = this->bounds_[b]; i < this->bounds_[b + 1]; ++i ) {
+
+      const unsigned int c = this->order_[i];
+      if ( not states[c].belowThreshold ) {
+
+        open.push_back( c );
+      }
+    }
+    if ( open.size() > ( blocks.size() > 0 ? blocks.back() : 0 ) ) {
+
+      blocks.push_back( open.size() );
+    }
+  }
+
+  // the resonance weights w_r = 1 / ( Er - E - i Gamma_r / 2 ), the padding
+  // resonances keep a zero weight
+  const unsigned int number = table.numberResonances();
+  const unsigned int padded = table.paddedSize();
+  if ( workspace.real.size() != padded ) {
+
+    workspace.real.assign( padded, 0. );
+    workspace.imaginary.assign( padded, 0. );
+  }
+  double* real = workspace.real.data();
+  double* imaginary = workspace.imaginary.data();
+  const double* er = table.packedEnergies();
+  const double* eliminated = table.packedEliminatedWidths();
+  const double e = energy.value;
+  for ( unsigned int r = 0; r < number; ++r ) {
+
+    const double delta = er[r] - e;
+    const double inverse = 1. / ( delta * delta
+                                  + eliminated[r] * eliminated[r] );
+    real[r] = delta * inverse;
+    imaginary[r] = eliminated[r] * inverse;
+  }
+
+  // accumulate the upper triangle of each diagonal block of the rmatrix as
+  // the weighted sums R_cc' = sum_r w_r gamma_rc gamma_rc' for the open
+  // channels, the lanes are reduced in a fixed order and the lower triangle is
+  // obtained by symmetry
+  constexpr unsigned int lanes = ResonanceTable::lanes;
+  const unsigned int active = open.size();
+  rmatrix.setZero( active, active );
+  for ( unsigned int a = 0, end = 0, next = 0; a < active; ++a ) {
+
+    if ( a == end ) {
+
+      end = blocks[ next++ ];
+    }
+    for ( unsigned int b = a; b < end; ++b ) {
+
+      const double* products = table.packedProducts( open[a], open[b] );
+      double re[ lanes ] = {};
+      double im[ lanes ] = {};
+      for ( unsigned int block = 0; block < padded; block += lanes ) {
+
+        for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+          const unsigned int r = block + lane;
+          re[ lane ] += real[r] * products[r];
+          im[ lane ] += imaginary[r] * products[r];
+        }
+      }
+
+      double sumre = 0.;
+      double sumim = 0.;
+      for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+        sumre += re[ lane ];
+        sumim += im[ lane ];
+      }
+      rmatrix( a, b ) = std::complex< double >( sumre, sumim );
+      rmatrix( b, a ) = rmatrix( a, b );
+    }
+  }
+
+  // calculate the L matrix
+  this->lmatrix_( states, channels, workspace.lmatrix );
+}
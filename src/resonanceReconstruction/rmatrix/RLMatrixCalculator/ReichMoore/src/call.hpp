@@ -3,57 +3,131 @@
  *
  *  @param[in] energy            the energy value
  *  @param[in] table             the resonance table
- *  @param[in] penetrabilities   the channel penetrabilities
+ *  @param[in] states            the channel states at the current energy
  *  @param[in] channels          the channels
+ *  @param[in,out] workspace     the workspace in which the R, L and
+ *                               ( I - RL )^-1 R matrices are stored
  *
  *  @return The resulting ( I - RL )^-1 R matrix
  */
-template < typename Penetrabilities, typename Channels >
+template < typename Channels >
 const Matrix< std::complex< double > >&
 operator()( const Energy& energy,
             const ResonanceTable& table,
-            const Penetrabilities& penetrabilities,
-            const Channels& channels ) {
-
-  // range with the R-matrices for each resonance
-  auto rmatrices = table.resonances()
-                     | ranges::view::transform(
-                         [&] ( const auto& resonance )
-                             { return resonance.rmatrix( energy ); } );
-
-  // accumulate the rmatrix
-  const unsigned int size = table.numberChannels();
-  this->rmatrix_ = Matrix< std::complex< double > >::Zero( size, size );
-  for ( const auto& rmatrix : rmatrices ) {
-    for ( unsigned int c = 0; c < size; ++c ) {
-      for ( unsigned int cprime = 0; cprime < size; ++cprime ) {
-        this->rmatrix_( c, cprime ) += rmatrix[c][cprime];
+            const std::vector< ChannelState >& states,
+            const Channels& channels,
+            SpinGroupWorkspace& workspace ) const {
+
+  std::vector< unsigned int > columns( table.numberChannels() );
+  std::iota( columns.begin(), columns.end(), 0u );
+  return ( *this )( energy, table, states, channels,
+                    columns, workspace );
+}
+
+/**
+ *  @brief Calculate a number of columns of the ( I - RL )^-1 R matrix
+ *
+ *  Since the ( I - RL )^-1 R matrix is symmetric, the columns are also the
+ *  rows of the matrix. Column k of the resulting matrix is the column (or
+ *  row) of the ( I - RL )^-1 R matrix given by columns[k].
+ *
+ *  @param[in] energy            the energy value
+ *  @param[in] table             the resonance table
+ *  @param[in] states            the channel states at the current energy
+ *  @param[in] channels          the channels
+ *  @param[in] columns           the indices of the columns to be calculated
+ *  @param[in,out] workspace     the workspace in which the R, L and
+ *                               ( I - RL )^-1 R matrices are stored
+ *
+ *  @return The requested columns of the ( I - RL )^-1 R matrix
+ */
+template < typename Channels >
+const Matrix< std::complex< double > >&
+operator()( const Energy& energy,
+            const ResonanceTable& table,
+            const std::vector< ChannelState >& states,
+            const Channels& channels,
+            const std::vector< unsigned int >& columns,
+            SpinGroupWorkspace& workspace ) const {
+
+  if ( this->level_ ) {
+
+    return this->solveLevelMatrix( energy, table, states, channels,
+                                   columns, workspace );
+  }
+
+  this->assemble( energy, table, states, channels, workspace );
+
+  const auto& open = workspace.open;
+  const unsigned int size = states.size();
+  auto& rlmatrix = workspace.rlmatrix;
+  if ( this->coupled_ && ( open.size() == size ) ) {
+
+    this->solve_( workspace.rmatrix, workspace.lmatrix, columns,
+                  workspace, rlmatrix );
+    return rlmatrix;
+  }
+
+  // the rows and columns of ( I - RL )^-1 R for channels below threshold or
+  // without any width are zero and ( I - RL )^-1 R is block diagonal, so that
+  // every block of open channels is solved separately using the compacted R
+  // and L matrices of that block, after which the result is scattered into
+  // the requested columns
+  const unsigned int active = open.size();
+  auto& position = workspace.position;
+  position.assign( size, size );
+  for ( unsigned int a = 0; a < active; ++a ) {
+
+    position[ open[a] ] = a;
+  }
+
+  rlmatrix.setZero( size, columns.size() );
+  auto& requested = workspace.columns;
+  for ( unsigned int start = 0, next = 0; start < active; ++next ) {
+
+    const unsigned int end = workspace.blocks[ next ];
+    const unsigned int number = end - start;
+    auto inBlock = [&] ( unsigned int c ) {
+
+      return ( position[c] >= start ) && ( position[c] < end );
+    };
+
+    requested.clear();
+    for ( const auto c : columns ) {
+
+      if ( inBlock( c ) ) {
+
+        requested.push_back( position[c] - start );
       }
     }
-  }
 
-  // zero out threshold reactions
-  auto belowThreshold = channels
-         | ranges::view::transform(
-              [&] ( const auto& channel )
-                  { return std::visit(
-                               [&] ( const auto& channel )
-                                   { return channel.belowThreshold( energy ); },
-                               channel ); } );
-  for ( unsigned int c = 0; c < size; ++c ) {
+    if ( requested.size() > 0 ) {
+
+      auto& rblock = workspace.rblock;
+      auto& lblock = workspace.lblock;
+      rblock = workspace.rmatrix.block( start, start, number, number );
+      lblock.resize( number );
+      for ( unsigned int a = 0; a < number; ++a ) {
+
+        lblock.diagonal()[a] =
+            workspace.lmatrix.diagonal()[ open[ start + a ] ];
+      }
 
-    if ( belowThreshold[c] ) {
+      auto& compact = workspace.compact;
+      makeSolver( number )( rblock, lblock, requested, workspace, compact );
+      for ( unsigned int k = 0, j = 0; k < columns.size(); ++k ) {
 
-      this->rmatrix_.row(c).setZero();
-      this->rmatrix_.col(c).setZero();
+        if ( inBlock( columns[k] ) ) {
+
+          for ( unsigned int a = 0; a < number; ++a ) {
+
+            rlmatrix( open[ start + a ], k ) = compact( a, j );
+          }
+          ++j;
+        }
+      }
     }
+    start = end;
   }
-
-  // calculate and return R_L = ( 1 - RL )^-1 R
-  this->rlmatrix_ = Matrix< double >::Identity( size, size );
-  this->rlmatrix_ -= this->rmatrix_ *
-                     this->lmatrix_( energy, penetrabilities, channels );
-  this->rlmatrix_ = this->rlmatrix_.inverse();
-  this->rlmatrix_ *= this->rmatrix_;
-  return this->rlmatrix_;
+  return rlmatrix;
 }
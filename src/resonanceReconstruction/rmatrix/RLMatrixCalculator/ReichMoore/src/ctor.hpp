@@ -0,0 +1,26 @@
+/**
+ *  @brief Constructor
+ *
+ *  The level matrix calculation is used when it is expected to be cheaper
+ *  than the channel matrix calculation.
+ *
+ *  @param[in] table   the resonance table of the spin group
+ */
+RLMatrixCalculator( const ResonanceTable& table ) :
+  RLMatrixCalculator( table, isLevelMatrixCheaper( table ) ) {}
+
+/**
+ *  @brief Constructor using the channel matrix calculation
+ *
+ *  @param[in] table   the resonance table of the spin group
+ */
+RLMatrixCalculator( const ResonanceTable& table, ChannelMatrix ) :
+  RLMatrixCalculator( table, false ) {}
+
+/**
+ *  @brief Constructor using the level matrix calculation
+ *
+ *  @param[in] table   the resonance table of the spin group
+ */
+RLMatrixCalculator( const ResonanceTable& table, LevelMatrix ) :
+  RLMatrixCalculator( table, true ) {}
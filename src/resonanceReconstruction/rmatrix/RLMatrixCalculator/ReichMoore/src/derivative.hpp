@@ -0,0 +1,131 @@
+/**
+ *  @brief Calculate the derivative of the ( I - RL )^-1 R matrix with respect
+ *         to the incident energy
+ *
+ *  With X = ( I - RL )^-1 R and M = I - RL, the derivative is given by:
+ *    dX/dE = M^-1 dR/dE ( I + LX ) + X dL/dE X
+ *  Since M X = R, the inverse of M is obtained from X itself without any
+ *  additional factorisation: M^-1 = I + XL. X is symmetric and L is
+ *  diagonal so that ( I + LX ) is the transpose of M^-1.
+ *
+ *  The derivative of the R matrix is given by the weighted sums
+ *  dR_cc'/dE = sum_r w_r^2 gamma_rc gamma_rc' in which w_r is the resonance
+ *  weight 1 / ( Er - E - i Gamma_r / 2 ). Only the coupled channels above
+ *  threshold are included: the rows and columns of X and dR/dE for the other
+ *  channels are zero, so that they do not contribute to the derivative.
+ *
+ *  This function requires the complete ( I - RL )^-1 R matrix at the same
+ *  energy to be stored in workspace.rlmatrix (obtained by calling this
+ *  calculator without requesting specific columns). The resonance weights in
+ *  the workspace are replaced by their derivatives.
+ *
+ *  @param[in] energy            the energy value
+ *  @param[in] table             the resonance table
+ *  @param[in] states            the channel states at the current energy
+ *  @param[in] derivatives       the derivatives of the penetrability, shift
+ *                               factor and phase shift of each channel
+ *  @param[in] channels          the channels
+ *  @param[in,out] workspace     the workspace in which the derivatives of the
+ *                               R, L and ( I - RL )^-1 R matrices are stored
+ *
+ *  @return The resulting derivative of the ( I - RL )^-1 R matrix (in 1/eV)
+ */
+template < typename Channels >
+const Matrix< std::complex< double > >&
+derivative( const Energy& energy,
+            const ResonanceTable& table,
+            const std::vector< ChannelState >& states,
+            const std::vector< std::array< double, 3 > >& derivatives,
+            const Channels& channels,
+            SpinGroupWorkspace& workspace ) const {
+
+  const unsigned int size = states.size();
+
+  // the L matrix and its derivative
+  this->lmatrix_( states, channels, workspace.lmatrix );
+  this->lmatrix_.derivative( derivatives, channels, workspace.lderivative );
+
+  // the derivatives of the resonance weights dw_r/dE = w_r^2, the padding
+  // resonances keep a zero weight
+  const unsigned int number = table.numberResonances();
+  const unsigned int padded = table.paddedSize();
+  if ( workspace.real.size() != padded ) {
+
+    workspace.real.assign( padded, 0. );
+    workspace.imaginary.assign( padded, 0. );
+  }
+  double* real = workspace.real.data();
+  double* imaginary = workspace.imaginary.data();
+  const double* er = table.packedEnergies();
+  const double* eliminated = table.packedEliminatedWidths();
+  const double e = energy.value;
+  for ( unsigned int r = 0; r < number; ++r ) {
+
+    const double delta = er[r] - e;
+    const double inverse = 1. / ( delta * delta
+                                  + eliminated[r] * eliminated[r] );
+    real[r] = ( delta - eliminated[r] ) * ( delta + eliminated[r] )
+              * inverse * inverse;
+    imaginary[r] = 2. * delta * eliminated[r] * inverse * inverse;
+  }
+
+  // accumulate the upper triangle of each diagonal block of dR/dE for the
+  // channels above threshold in the same way as the R matrix, the lower
+  // triangle is obtained by symmetry
+  constexpr unsigned int lanes = ResonanceTable::lanes;
+  auto& rderivative = workspace.rderivative;
+  rderivative.setZero( size, size );
+  for ( unsigned int b = 0; b + 1 < this->bounds_.size(); ++b ) {
+
+    for ( unsigned int i = this->bounds_[b]; i < this->bounds_[b + 1]; ++i ) {
+
+      const unsigned int c = this->order_[i];
+      if ( states[c].belowThreshold ) {
+
+        continue;
+      }
+      for ( unsigned int j = i; j < this->bounds_[b + 1]; ++j ) {
+
+        const unsigned int cprime = this->order_[j];
+        if ( states[cprime].belowThreshold ) {
+
+          continue;
+        }
+
+        const double* products = table.packedProducts( c, cprime );
+        double re[ lanes ] = {};
+        double im[ lanes ] = {};
+        for ( unsigned int block = 0; block < padded; block += lanes ) {
+
+          for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+            const unsigned int r = block + lane;
+            re[ lane ] += real[r] * products[r];
+            im[ lane ] += imaginary[r] * products[r];
+          }
+        }
+
+        double sumre = 0.;
+        double sumim = 0.;
+        for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+          sumre += re[ lane ];
+          sumim += im[ lane ];
+        }
+        rderivative( c, cprime ) = std::complex< double >( sumre, sumim );
+        rderivative( cprime, c ) = rderivative( c, cprime );
+      }
+    }
+  }
+
+  // M^-1 = I + XL and dX/dE = M^-1 dR/dE ( M^-1 )^T + X dL/dE X
+  const auto& rlmatrix = workspace.rlmatrix;
+  auto& inverse = workspace.inverse;
+  inverse.noalias() = rlmatrix * workspace.lmatrix;
+  inverse.diagonal().array() += 1.;
+
+  auto& rlderivative = workspace.rlderivative;
+  rlderivative.noalias() = inverse * rderivative * inverse.transpose();
+  rlderivative.noalias() += rlmatrix * workspace.lderivative * rlmatrix;
+  return rlderivative;
+}
@@ -0,0 +1,35 @@
+/**
+ *  @brief Determine whether or not the level matrix calculation is expected
+ *         to be cheaper than the channel matrix calculation
+ *
+ *  For a spin group with N resonances and C channels, the channel matrix
+ *  calculation requires about N C ( C + 1 ) / 2 operations to assemble the
+ *  R matrix and C^3 / 3 operations to factorise ( I - RL ). The level matrix
+ *  calculation requires about C N ( N + 1 ) / 2 operations to assemble the
+ *  inverse level matrix, N^3 / 3 operations to factorise it and N C
+ *  operations to project every requested column back onto the channels.
+ *
+ *  These estimates only apply to the general channel matrix calculation: for
+ *  spin groups with 1 to 4 channels, the channel matrix calculation uses
+ *  fixed size matrices (without any memory allocation) which is always
+ *  considered to be cheaper than the level matrix calculation.
+ *
+ *  @param[in] table   the resonance table
+ */
+static bool isLevelMatrixCheaper( const ResonanceTable& table ) {
+
+  const double number = table.numberResonances();
+  const double size = table.numberChannels();
+
+  if ( ( number == 0. ) || ( size <= 4. ) ) {
+
+    return false;
+  }
+
+  const double channel = number * size * ( size + 1. ) / 2.
+                         + size * size * size / 3.;
+  const double level = size * number * ( number + 1. ) / 2.
+                       + number * number * number / 3.
+                       + number * size;
+  return level < channel;
+}
@@ -0,0 +1,70 @@
+/**
+ *  @brief Determine the independent channel blocks of a resonance table
+ *
+ *  Two channels are coupled when at least one resonance has a non zero
+ *  reduced width in both channels. The channel blocks are the groups of
+ *  channels that are coupled directly or through other channels, so that the
+ *  R matrix (and thus the ( I - RL )^-1 R matrix) is block diagonal. Channels
+ *  without any non zero reduced width do not belong to any block.
+ *
+ *  The channels of all blocks are stored in order (the channels in a block are
+ *  given in increasing order, the blocks are ordered using their first
+ *  channel) and the bounds give the start of each block in this order, with
+ *  the end of the last block as the final value.
+ *
+ *  @param[in] table    the resonance table
+ *  @param[out] order   the channels, grouped per block
+ *  @param[out] bounds  the start of each block in the channel order
+ */
+static void makeBlocks( const ResonanceTable& table,
+                        std::vector< unsigned int >& order,
+                        std::vector< unsigned int >& bounds ) {
+
+  const unsigned int size = table.numberChannels();
+  const unsigned int padded = table.paddedSize();
+  auto coupled = [&] ( unsigned int c, unsigned int cprime ) {
+
+    const double* products = table.packedProducts( c, cprime );
+    return std::any_of( products, products + padded,
+                        [] ( double value ) { return value != 0.; } );
+  };
+
+  // label every channel with the smallest channel it is coupled to, labels
+  // are merged until no label changes anymore
+  std::vector< unsigned int > label( size );
+  std::iota( label.begin(), label.end(), 0u );
+  bool changed = true;
+  while ( changed ) {
+
+    changed = false;
+    for ( unsigned int c = 0; c < size; ++c ) {
+
+      for ( unsigned int cprime = c + 1; cprime < size; ++cprime ) {
+
+        if ( ( label[c] != label[cprime] ) && coupled( c, cprime ) ) {
+
+          label[c] = label[cprime] = std::min( label[c], label[cprime] );
+          changed = true;
+        }
+      }
+    }
+  }
+
+  order.clear();
+  bounds.clear();
+  for ( unsigned int first = 0; first < size; ++first ) {
+
+    if ( ( label[first] == first ) && coupled( first, first ) ) {
+
+      bounds.push_back( order.size() );
+      for ( unsigned int c = first; c < size; ++c ) {
+
+        if ( label[c] == first ) {
+
+          order.push_back( c );
+        }
+      }
+    }
+  }
+  bounds.push_back( order.size() );
+}
@@ -0,0 +1,25 @@
+/**
+ *  @brief Extract the reduced widths from a resonance table
+ *
+ *  The reduced widths are stored in a matrix with a row for every resonance
+ *  and a column for every channel (so that the widths of all resonances for a
+ *  given channel are stored contiguously).
+ *
+ *  @param[in] table   the resonance table
+ */
+static Matrix< double > makeWidths( const ResonanceTable& table ) {
+
+  const unsigned int number = table.numberResonances();
+  const unsigned int size = table.numberChannels();
+
+  Matrix< double > widths( number, size );
+  for ( unsigned int r = 0; r < number; ++r ) {
+
+    const auto resonance = table.resonances()[r];
+    for ( unsigned int c = 0; c < size; ++c ) {
+
+      widths( r, c ) = resonance.widths()[c].value;
+    }
+  }
+  return widths;
+}
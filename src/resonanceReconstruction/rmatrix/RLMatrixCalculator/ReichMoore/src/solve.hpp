@@ -0,0 +1,85 @@
+/**
+ *  @brief Calculate columns of the ( I - RL )^-1 R matrix for a spin group
+ *         with a fixed number of channels
+ *
+ *  The calculation uses fixed size matrices so that no memory is allocated
+ *  and the closed form inverse provided by Eigen for matrices up to 4x4 is
+ *  used.
+ *
+ *  @param[in] rmatrix         the R matrix
+ *  @param[in] lmatrix         the L matrix
+ *  @param[in] columns         the indices of the columns to be calculated
+ *  @param[in,out] workspace   the workspace (unused)
+ *  @param[out] rlmatrix       the resulting columns
+ */
+template < int Size >
+static void solve( const Matrix< std::complex< double > >& rmatrix,
+                   const DiagonalMatrix< std::complex< double > >& lmatrix,
+                   const std::vector< unsigned int >& columns,
+                   SpinGroupWorkspace&,
+                   Matrix< std::complex< double > >& rlmatrix ) {
+
+  using Fixed = Eigen::Matrix< std::complex< double >, Size, Size >;
+
+  const Fixed r = rmatrix;
+  Fixed matrix = Fixed::Identity();
+  matrix -= r * lmatrix;
+  const Fixed inverse = matrix.inverse();
+
+  rlmatrix.resize( Size, columns.size() );
+  for ( unsigned int k = 0; k < columns.size(); ++k ) {
+
+    rlmatrix.col( k ).noalias() = inverse * r.col( columns[k] );
+  }
+}
+
+/**
+ *  @brief Calculate columns of the ( I - RL )^-1 R matrix for a spin group
+ *         with an arbitrary number of channels
+ *
+ *  The ( I - RL ) matrix is factorised using an LU decomposition (stored in
+ *  the workspace) after which a linear system is solved for each requested
+ *  column of R, so that the full inverse is never calculated.
+ *
+ *  @param[in] rmatrix         the R matrix
+ *  @param[in] lmatrix         the L matrix
+ *  @param[in] columns         the indices of the columns to be calculated
+ *  @param[in,out] workspace   the workspace in which the LU decomposition is
+ *                             stored
+ *  @param[out] rlmatrix       the resulting columns
+ */
+static void solve( const Matrix< std::complex< double > >& rmatrix,
+                   const DiagonalMatrix< std::complex< double > >& lmatrix,
+                   const std::vector< unsigned int >& columns,
+                   SpinGroupWorkspace& workspace,
+                   Matrix< std::complex< double > >& rlmatrix ) {
+
+  const unsigned int size = rmatrix.rows();
+  rlmatrix = Matrix< double >::Identity( size, size );
+  rlmatrix -= rmatrix * lmatrix;
+  workspace.lu.compute( rlmatrix );
+
+  rlmatrix.resize( size, columns.size() );
+  for ( unsigned int k = 0; k < columns.size(); ++k ) {
+
+    rlmatrix.col( k ) = workspace.lu.solve( rmatrix.col( columns[k] ) );
+  }
+}
+
+/**
+ *  @brief Select the function calculating the ( I - RL )^-1 R matrix for a
+ *         given number of channels
+ *
+ *  @param[in] channels   the number of channels
+ */
+static Solver makeSolver( unsigned int channels ) {
+
+  switch ( channels ) {
+
+    case 1 : return &solve< 1 >;
+    case 2 : return &solve< 2 >;
+    case 3 : return &solve< 3 >;
+    case 4 : return &solve< 4 >;
+    default : return static_cast< Solver >( &solve );
+  }
+}
@@ -0,0 +1,115 @@
+/**
+ *  @brief Calculate a number of columns of the ( I - RL )^-1 R matrix using
+ *         the level matrix
+ *
+ *  With gamma the matrix of the reduced widths (a row for every resonance and
+ *  a column for every channel) and R = gamma^T W gamma in which W is the
+ *  diagonal matrix of the resonance weights 1 / ( Er - E - i Gamma / 2 ), the
+ *  ( I - RL )^-1 R matrix is equal to gamma^T A gamma in which A is the level
+ *  matrix:
+ *    A^-1 = W^-1 - gamma L gamma^T
+ *
+ *  The inverse level matrix is a symmetric matrix with a row and column for
+ *  every resonance so that this calculation is cheaper than the channel
+ *  matrix calculation when there are fewer resonances than channels. Only the
+ *  channels above threshold are included in gamma L gamma^T, and the rows and
+ *  columns for the channels below threshold are zero.
+ *
+ *  @param[in] energy            the energy value
+ *  @param[in] table             the resonance table
+ *  @param[in] states            the channel states at the current energy
+ *  @param[in] channels          the channels
+ *  @param[in] columns           the indices of the columns to be calculated
+ *  @param[in,out] workspace     the workspace in which the L matrix, the
+ *                               inverse level matrix and ( I - RL )^-1 R
+ *                               matrix are stored
+ *
+ *  @return The requested columns of the ( I - RL )^-1 R matrix
+ */
+template < typename Channels >
+const Matrix< std::complex< double > >&
+solveLevelMatrix( const Energy& energy,
+                  const ResonanceTable& table,
+                  const std::vector< ChannelState >& states,
+                  const Channels& channels,
+                  const std::vector< unsigned int >& columns,
+                  SpinGroupWorkspace& workspace ) const {
+
+  const unsigned int size = states.size();
+  const unsigned int number = table.numberResonances();
+  auto& rlmatrix = workspace.rlmatrix;
+  rlmatrix.setZero( size, columns.size() );
+  if ( number == 0 ) {
+
+    return rlmatrix;
+  }
+
+  // the channels above threshold
+  auto& open = workspace.open;
+  open.clear();
+  for ( unsigned int c = 0; c < size; ++c ) {
+
+    if ( not states[c].belowThreshold ) {
+
+      open.push_back( c );
+    }
+  }
+
+  // calculate the L matrix
+  this->lmatrix_( states, channels, workspace.lmatrix );
+
+  // accumulate the upper triangle of - gamma L gamma^T one channel at a time,
+  // add W^-1 on the diagonal and obtain the lower triangle by symmetry
+  auto& amatrix = workspace.amatrix;
+  amatrix.setZero( number, number );
+  for ( const auto c : open ) {
+
+    const double* gamma = this->widths_.col( c ).data();
+    const std::complex< double > l = workspace.lmatrix.diagonal()[c];
+    for ( unsigned int s = 0; s < number; ++s ) {
+
+      const std::complex< double > product = gamma[s] * l;
+      for ( unsigned int r = 0; r <= s; ++r ) {
+
+        amatrix( r, s ) -= gamma[r] * product;
+      }
+    }
+  }
+
+  const double* er = table.packedEnergies();
+  const double* eliminated = table.packedEliminatedWidths();
+  const double e = energy.value;
+  for ( unsigned int s = 0; s < number; ++s ) {
+
+    amatrix( s, s ) += std::complex< double >( er[s] - e, -eliminated[s] );
+    for ( unsigned int r = 0; r < s; ++r ) {
+
+      amatrix( s, r ) = amatrix( r, s );
+    }
+  }
+  workspace.lu.compute( amatrix );
+
+  // solve A^-1 x = gamma_c for every requested column c above threshold and
+  // project the solutions onto the channels above threshold
+  auto& levels = workspace.levels;
+  levels.resize( number, columns.size() );
+  for ( unsigned int k = 0; k < columns.size(); ++k ) {
+
+    levels.col( k ) = this->widths_.col( columns[k] )
+                                  .cast< std::complex< double > >();
+  }
+  workspace.compact = workspace.lu.solve( levels );
+
+  for ( unsigned int k = 0; k < columns.size(); ++k ) {
+
+    if ( not states[ columns[k] ].belowThreshold ) {
+
+      for ( const auto c : open ) {
+
+        rlmatrix( c, k ) =
+            this->widths_.col( c ).dot( workspace.compact.col( k ) );
+      }
+    }
+  }
+  return rlmatrix;
+}
@@ -0,0 +1,298 @@
+#define CATCH_CONFIG_MAIN
+
+#include <random>
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+// convenience typedefs
+template < typename Formalism, typename BoundaryOption >
+using RLMatrixCalculator =
+    rmatrix::RLMatrixCalculator< Formalism, BoundaryOption >;
+using ReichMoore = rmatrix::ReichMoore;
+using ShiftFactor = rmatrix::ShiftFactor;
+using SpinGroupWorkspace = rmatrix::SpinGroupWorkspace;
+using ResonanceTable = rmatrix::ResonanceTable;
+using Resonance = rmatrix::Resonance;
+using ChannelID = rmatrix::ChannelID;
+using ChannelState = rmatrix::ChannelState;
+using ChannelMatrix = rmatrix::ChannelMatrix;
+template < typename T > using Matrix = rmatrix::Matrix< T >;
+template < typename T > using DiagonalMatrix = rmatrix::DiagonalMatrix< T >;
+
+namespace {
+
+struct Calculator : RLMatrixCalculator< ReichMoore, ShiftFactor > {
+  using RLMatrixCalculator< ReichMoore, ShiftFactor >::solve;
+  using RLMatrixCalculator< ReichMoore, ShiftFactor >::makeSolver;
+  template < int Size > static auto fixed() { return &solve< Size >; }
+};
+
+// a random symmetric R matrix and a random diagonal L matrix
+void randomSystem( unsigned int size, std::mt19937& generator,
+                   Matrix< std::complex< double > >& rmatrix,
+                   DiagonalMatrix< std::complex< double > >& lmatrix ) {
+
+  std::uniform_real_distribution< double > distribution( -1., 1. );
+  auto random = [&] { return std::complex< double >(
+                                 distribution( generator ),
+                                 distribution( generator ) ); };
+
+  rmatrix.resize( size, size );
+  lmatrix.resize( size );
+  for ( unsigned int i = 0; i < size; ++i ) {
+
+    for ( unsigned int j = i; j < size; ++j ) {
+
+      rmatrix( i, j ) = rmatrix( j, i ) = random();
+    }
+    lmatrix.diagonal()[i] = random();
+  }
+}
+
+} // namespace
+
+SCENARIO( "solve" ) {
+
+  GIVEN( "random symmetric systems with 1 to 4 channels" ) {
+
+    std::mt19937 generator( 4 );
+    SpinGroupWorkspace workspace;
+    Matrix< std::complex< double > > rmatrix;
+    DiagonalMatrix< std::complex< double > > lmatrix;
+    Matrix< std::complex< double > > fixed;
+    Matrix< std::complex< double > > dynamic;
+
+    THEN( "the fixed size solutions are equal to the dynamic solutions" ) {
+
+      auto check = [&] ( auto solver, unsigned int size ) {
+
+        for ( unsigned int trial = 0; trial < 10; ++trial ) {
+
+          randomSystem( size, generator, rmatrix, lmatrix );
+
+          // every column and a subset of the columns in a different order
+          std::vector< std::vector< unsigned int > > selections = {
+            std::vector< unsigned int >( size ), { size - 1, 0 } };
+          std::iota( selections[0].begin(), selections[0].end(), 0u );
+
+          for ( const auto& columns : selections ) {
+
+            solver( rmatrix, lmatrix, columns, workspace, fixed );
+            Calculator::solve( rmatrix, lmatrix, columns, workspace,
+                               dynamic );
+
+            REQUIRE( size == fixed.rows() );
+            REQUIRE( columns.size() == fixed.cols() );
+            REQUIRE( size == dynamic.rows() );
+            REQUIRE( columns.size() == dynamic.cols() );
+            for ( unsigned int i = 0; i < size; ++i ) {
+
+              for ( unsigned int k = 0; k < columns.size(); ++k ) {
+
+                CHECK( dynamic( i, k ).real() ==
+                       Approx( fixed( i, k ).real() ).margin( 1e-12 ) );
+                CHECK( dynamic( i, k ).imag() ==
+                       Approx( fixed( i, k ).imag() ).margin( 1e-12 ) );
+              }
+            }
+          }
+        }
+      };
+
+      check( Calculator::fixed< 1 >(), 1 );
+      check( Calculator::fixed< 2 >(), 2 );
+      check( Calculator::fixed< 3 >(), 3 );
+      check( Calculator::fixed< 4 >(), 4 );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
+
+SCENARIO( "column solve" ) {
+
+  GIVEN( "random symmetric systems with multiple channels" ) {
+
+    std::mt19937 generator( 10 );
+    SpinGroupWorkspace workspace;
+    Matrix< std::complex< double > > rmatrix;
+    DiagonalMatrix< std::complex< double > > lmatrix;
+    Matrix< std::complex< double > > columns;
+
+    THEN( "the requested columns are equal to the columns of the full "
+          "( I - RL )^-1 R matrix" ) {
+
+      for ( unsigned int size = 2; size <= 8; ++size ) {
+
+        randomSystem( size, generator, rmatrix, lmatrix );
+
+        // the full matrix using the inverse of ( I - RL )
+        Matrix< std::complex< double > > matrix =
+            Matrix< std::complex< double > >::Identity( size, size );
+        matrix -= rmatrix * lmatrix;
+        const Matrix< std::complex< double > > full =
+            matrix.inverse() * rmatrix;
+
+        for ( const std::vector< unsigned int >& requested :
+                  { std::vector< unsigned int >{ 0 },
+                    std::vector< unsigned int >{ size - 1, 1 } } ) {
+
+          Calculator::makeSolver( size )( rmatrix, lmatrix, requested,
+                                          workspace, columns );
+
+          REQUIRE( size == columns.rows() );
+          REQUIRE( requested.size() == columns.cols() );
+          for ( unsigned int k = 0; k < requested.size(); ++k ) {
+
+            for ( unsigned int i = 0; i < size; ++i ) {
+
+              const auto expected = full( i, requested[k] );
+              CHECK( expected.real() ==
+                     Approx( columns( i, k ).real() ).margin( 1e-12 ) );
+              CHECK( expected.imag() ==
+                     Approx( columns( i, k ).imag() ).margin( 1e-12 ) );
+            }
+          }
+
+          // ( I - RL )^-1 R is symmetric: the columns are also the rows
+          for ( unsigned int k = 0; k < requested.size(); ++k ) {
+
+            for ( unsigned int i = 0; i < size; ++i ) {
+
+              const auto row = full( requested[k], i );
+              CHECK( row.real() ==
+                     Approx( columns( i, k ).real() ).margin( 1e-12 ) );
+              CHECK( row.imag() ==
+                     Approx( columns( i, k ).imag() ).margin( 1e-12 ) );
+            }
+          }
+        }
+      }
+    } // THEN
+  } // GIVEN
+} // SCENARIO
+
+SCENARIO( "open channel compaction" ) {
+
+  GIVEN( "coupled spin groups in which some channels are below threshold" ) {
+
+    std::mt19937 generator( 18 );
+    std::uniform_real_distribution< double > distribution( -1., 1. );
+    SpinGroupWorkspace workspace;
+
+    THEN( "the rows and columns of the closed channels are zero and the "
+          "open channels are equal to the uncompacted solution" ) {
+
+      const double energy = 1.5e+3;
+      for ( unsigned int size : { 3u, 6u } ) {
+
+        // a table in which every resonance couples all channels
+        std::vector< ChannelID > identifiers;
+        for ( unsigned int c = 0; c < size; ++c ) {
+
+          identifiers.push_back( std::to_string( c + 1 ) );
+        }
+        std::vector< Resonance > resonances;
+        for ( double er : { 1e+3, 2e+3, 5e+3 } ) {
+
+          std::vector< ReducedWidth > widths;
+          for ( unsigned int c = 0; c < size; ++c ) {
+
+            widths.push_back( ( 1. + distribution( generator ) ) *
+                              rootElectronVolt );
+          }
+          resonances.emplace_back( er * electronVolt, std::move( widths ),
+                                   0.1 * rootElectronVolt );
+        }
+        ResonanceTable table( std::move( identifiers ),
+                              std::move( resonances ) );
+        RLMatrixCalculator< ReichMoore, ShiftFactor >
+            calculator( table, ChannelMatrix() );
+
+        // channel 1 and (for the larger group) channel 4 are closed
+        std::vector< ChannelState > states;
+        for ( unsigned int c = 0; c < size; ++c ) {
+
+          const bool closed = ( c == 1 ) or ( c == 4 );
+          states.push_back( ChannelState{ 1. / rootBarn, 0., 0., 0., 0.,
+                                          closed ? 0. : 0.5 + 0.1 * c,
+                                          0., 0., 0., closed } );
+        }
+
+        // the uncompacted ( I - RL )^-1 R matrix: the R matrix of all
+        // channels with zero rows and columns for the closed channels
+        Matrix< std::complex< double > > rmatrix =
+            Matrix< std::complex< double > >::Zero( size, size );
+        for ( const auto& resonance : table.resonances() ) {
+
+          const auto widths = resonance.widths();
+          const double eliminated = resonance.eliminatedWidth().value;
+          const std::complex< double > weight =
+              1. / std::complex< double >( resonance.energy().value - energy,
+                                           -eliminated * eliminated );
+          for ( unsigned int c = 0; c < size; ++c ) {
+
+            for ( unsigned int cprime = 0; cprime < size; ++cprime ) {
+
+              if ( not ( states[c].belowThreshold or
+                         states[ cprime ].belowThreshold ) ) {
+
+                rmatrix( c, cprime ) +=
+                    weight * widths[c].value * widths[ cprime ].value;
+              }
+            }
+          }
+        }
+        Matrix< std::complex< double > > matrix =
+            Matrix< std::complex< double > >::Identity( size, size );
+        for ( unsigned int c = 0; c < size; ++c ) {
+
+          matrix.col( c ) -= rmatrix.col( c ) *
+              std::complex< double >( 0., states[c].penetrability );
+        }
+        const Matrix< std::complex< double > > full =
+            matrix.inverse() * rmatrix;
+
+        for ( const std::vector< unsigned int >& requested :
+                  { std::vector< unsigned int >{},
+                    std::vector< unsigned int >{ 1, size - 1, 0 } } ) {
+
+          std::vector< unsigned int > columns = requested;
+          if ( columns.size() == 0 ) {
+
+            columns.resize( size );
+            std::iota( columns.begin(), columns.end(), 0u );
+          }
+
+          const auto& result =
+              calculator( energy * electronVolt, table, states,
+                          table.channels(), columns, workspace );
+
+          REQUIRE( size == result.rows() );
+          REQUIRE( columns.size() == result.cols() );
+          for ( unsigned int k = 0; k < columns.size(); ++k ) {
+
+            for ( unsigned int i = 0; i < size; ++i ) {
+
+              if ( states[i].belowThreshold or
+                   states[ columns[k] ].belowThreshold ) {
+
+                CHECK( 0. == result( i, k ).real() );
+                CHECK( 0. == result( i, k ).imag() );
+              }
+              else {
+
+                const auto expected = full( i, columns[k] );
+                CHECK( expected.real() ==
+                       Approx( result( i, k ).real() ).margin( 1e-12 ) );
+                CHECK( expected.imag() ==
+                       Approx( result( i, k ).imag() ).margin( 1e-12 ) );
+              }
+            }
+          }
+        }
+      }
+    } // THEN
+  } // GIVEN
+} // SCENARIO
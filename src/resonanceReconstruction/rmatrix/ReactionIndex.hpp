@@ -0,0 +1,53 @@
+/**
+ *  @class
+ *  @brief A dense index of reaction identifiers
+ *
+ *  Every reaction identifier added to the index is assigned a small integer
+ *  slot (0, 1, 2, ...) in the order in which the reactions were first added.
+ *  These slots allow cross section values to be accumulated in a dense array
+ *  instead of a map using the reaction identifiers as keys.
+ */
+class ReactionIndex {
+
+  /* fields */
+  std::vector< ReactionID > reactions_;
+  std::map< ReactionID, unsigned int > slots_;
+
+public:
+
+  /* constructor */
+  ReactionIndex() = default;
+
+  /**
+   *  @brief Return the number of reactions (and slots) in the index
+   */
+  unsigned int size() const { return this->reactions_.size(); }
+
+  /**
+   *  @brief Return the reaction identifiers, ordered by slot
+   */
+  auto reactions() const { return ranges::view::all( this->reactions_ ); }
+
+  /**
+   *  @brief Return the reaction identifier for a given slot
+   *
+   *  @param[in] slot   the slot
+   */
+  const ReactionID& reaction( unsigned int slot ) const {
+
+    return this->reactions_[ slot ];
+  }
+
+  /**
+   *  @brief Return whether or not a reaction is present in the index
+   *
+   *  @param[in] reaction   the reaction identifier
+   */
+  bool contains( const ReactionID& reaction ) const {
+
+    return this->slots_.find( reaction ) != this->slots_.end();
+  }
+
+  #include "resonanceReconstruction/rmatrix/ReactionIndex/src/slot.hpp"
+  #include "resonanceReconstruction/rmatrix/ReactionIndex/src/intern.hpp"
+};
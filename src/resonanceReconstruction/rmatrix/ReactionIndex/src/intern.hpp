@@ -0,0 +1,17 @@
+/**
+ *  @brief Add a reaction to the index and return its slot
+ *
+ *  If the reaction is already present in the index, its current slot is
+ *  returned and the index remains unchanged.
+ *
+ *  @param[in] reaction   the reaction identifier
+ */
+unsigned int intern( const ReactionID& reaction ) {
+
+  const auto result = this->slots_.emplace( reaction, this->size() );
+  if ( result.second ) {
+
+    this->reactions_.push_back( reaction );
+  }
+  return result.first->second;
+}
@@ -0,0 +1,15 @@
+/**
+ *  @brief Return the slot for a given reaction
+ *
+ *  @param[in] reaction   the reaction identifier
+ */
+unsigned int slot( const ReactionID& reaction ) const {
+
+  const auto iter = this->slots_.find( reaction );
+  if ( iter == this->slots_.end() ) {
+
+    Log::error( "The requested reaction is not present in the reaction index" );
+    throw std::exception();
+  }
+  return iter->second;
+}
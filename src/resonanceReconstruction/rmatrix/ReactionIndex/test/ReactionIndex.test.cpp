@@ -0,0 +1,56 @@
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+// convenience typedefs
+using ReactionIndex = rmatrix::ReactionIndex;
+using ReactionID = rmatrix::ReactionID;
+
+SCENARIO( "ReactionIndex" ) {
+
+  GIVEN( "reaction identifiers" ) {
+
+    ReactionID elas( "n,Fe54->n,Fe54" );
+    ReactionID capt( "n,Fe54->capture" );
+    ReactionID fiss( "n,Fe54->fission" );
+
+    THEN( "reactions can be added to a ReactionIndex" ) {
+
+      ReactionIndex index;
+      CHECK( 0 == index.size() );
+      CHECK( false == index.contains( elas ) );
+
+      CHECK( 0 == index.intern( elas ) );
+      CHECK( 1 == index.intern( capt ) );
+      CHECK( 0 == index.intern( elas ) );
+      CHECK( 2 == index.intern( fiss ) );
+      CHECK( 1 == index.intern( capt ) );
+
+      CHECK( 3 == index.size() );
+      CHECK( 3 == index.reactions().size() );
+      CHECK( true == index.contains( elas ) );
+      CHECK( true == index.contains( capt ) );
+      CHECK( true == index.contains( fiss ) );
+
+      CHECK( 0 == index.slot( elas ) );
+      CHECK( 1 == index.slot( capt ) );
+      CHECK( 2 == index.slot( fiss ) );
+
+      CHECK( index.slot( index.reaction( 0 ) ) == 0 );
+      CHECK( index.slot( index.reaction( 1 ) ) == 1 );
+      CHECK( index.slot( index.reaction( 2 ) ) == 2 );
+    } // THEN
+
+    THEN( "an exception is thrown when requesting the slot of a reaction that "
+          "is not present" ) {
+
+      ReactionIndex index;
+      index.intern( elas );
+
+      CHECK_THROWS( index.slot( capt ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
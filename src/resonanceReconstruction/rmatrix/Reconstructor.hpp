@@ -1,6 +1,10 @@
 /**
  *  @class
  *  @brief Class used to reconstruct cross sections from ENDF resonances
+ *
+ *  The const member functions of the reconstructor do not modify the
+ *  reconstructor and can be called concurrently by multiple threads provided
+ *  that every thread uses its own evaluation workspace (see workspace()).
  */
 class Reconstructor {
 
@@ -8,24 +12,66 @@ class Reconstructor {
   Energy lower_;
   Energy upper_;
   CompoundSystemVariant system_;
+  EvaluationWorkspace workspace_;
+
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/Reconstructor/src/tabulate.hpp"
+  #include "resonanceReconstruction/rmatrix/Reconstructor/src/refine.hpp"
 
 public:
 
+  /**
+   *  @brief The relative width (with respect to the energy) below which an
+   *         interval is no longer bisected during linearization
+   */
+  static constexpr double minimumWidth = 1e-9;
+
+  /**
+   *  @brief The maximum number of seed intervals that are processed at the
+   *         same time during linearization
+   */
+  static constexpr unsigned int windowSize = 1024;
+
   /* constructor */
   Reconstructor( const Energy& lower, const Energy& upper,
                  const CompoundSystemVariant& reconstructor ) :
       lower_( lower ), upper_( upper ),
-      system_( reconstructor ) {}
+      system_( reconstructor ),
+      workspace_( this->workspace() ) {}
 
   /**
    *  @brief Return the compound system
    */
   CompoundSystemVariant& compoundSystem() { return this->system_; }
 
+  /**
+   *  @brief Return the compound system
+   */
+  const CompoundSystemVariant& compoundSystem() const { return this->system_; }
+
+  /**
+   *  @brief Return the reaction index of the compound system
+   */
+  const ReactionIndex& reactionIndex() const {
+
+    return std::visit( [] ( const auto& system ) -> const ReactionIndex&
+                          { return system.reactionIndex(); },
+                       this->system_ );
+  }
+
+  /**
+   *  @brief Return a new evaluation workspace for the compound system
+   */
+  EvaluationWorkspace workspace() const {
+
+    return std::visit( [] ( const auto& system ) { return system.workspace(); },
+                       this->system_ );
+  }
+
   /**
    *  @brief Return whether or not the reconstructor is for resolved resonances
    */
-  bool isResolved() {
+  bool isResolved() const {
 
     return this->system_.index() !=
            std::variant_size_v< CompoundSystemVariant > - 1;
@@ -34,7 +80,7 @@ public:
   /**
    *  @brief Return whether or not the reconstructor is for unresolved resonances
    */
-  bool isUnresolved() {
+  bool isUnresolved() const {
 
     return not this->isResolved();
   }
@@ -68,17 +114,96 @@ public:
 
   /**
    *  @brief Reconstruct the cross sections at the given energy
+   *
+   *  @param[in] energy          the incident energy
+   *  @param[in,out] workspace   the evaluation workspace (obtained through the
+   *                             workspace() function)
    */
-  std::map< ReactionID, CrossSection > operator()( const Energy& energy ) {
+  std::map< ReactionID, CrossSection >
+  operator()( const Energy& energy, EvaluationWorkspace& workspace ) const {
 
     std::map< ReactionID, CrossSection > result;
     if ( ( energy >= this->lowerEnergy() ) and
          ( energy <= this->upperEnergy() ) ) {
 
-      std::visit( [&] ( auto& system )
-                      { system.evaluate( energy, result ); },
+      std::visit( [&] ( const auto& system )
+                      { system.evaluate( energy, result, workspace ); },
                   this->system_ );
     }
     return result;
   }
+
+  /**
+   *  @brief Reconstruct the cross sections at the given energy
+   *
+   *  This function uses the workspace owned by the reconstructor and can
+   *  therefore not be used concurrently.
+   *
+   *  @param[in] energy   the incident energy
+   */
+  std::map< ReactionID, CrossSection > operator()( const Energy& energy ) {
+
+    return ( *this )( energy, this->workspace_ );
+  }
+
+  /**
+   *  @brief Reconstruct the cross sections on an energy grid
+   *
+   *  The cross sections for energies outside of the resonance range are
+   *  set to zero.
+   *
+   *  @param[in] energies        the incident energies
+   *  @param[in,out] workspace   the evaluation workspace (obtained through the
+   *                             workspace() function)
+   */
+  CrossSectionTable evaluate( std::vector< Energy > energies,
+                              EvaluationWorkspace& workspace ) const {
+
+    return this->tabulate(
+             std::move( energies ),
+             [&] ( const auto& system, CrossSectionTable& table,
+                   unsigned int begin, unsigned int end ) {
+
+               system.evaluate( table, begin, end, workspace );
+             } );
+  }
+
+  /**
+   *  @brief Reconstruct the cross sections on an energy grid
+   *
+   *  This function uses a temporary workspace.
+   *
+   *  @param[in] energies   the incident energies
+   */
+  CrossSectionTable evaluate( std::vector< Energy > energies ) const {
+
+    auto workspace = this->workspace();
+    return this->evaluate( std::move( energies ), workspace );
+  }
+
+  /**
+   *  @brief Reconstruct the cross sections on an energy grid using multiple
+   *         threads
+   *
+   *  The energies are distributed dynamically over a pool of threads, each
+   *  with its own evaluation workspace. The result is identical to the result
+   *  of the serial evaluation for any number of threads.
+   *
+   *  @param[in] energies   the incident energies
+   *  @param[in] threads    the number of threads (0 for the number of
+   *                        concurrent threads supported by the hardware)
+   */
+  CrossSectionTable evaluate( std::vector< Energy > energies,
+                              unsigned int threads ) const {
+
+    return this->tabulate(
+             std::move( energies ),
+             [&] ( const auto& system, CrossSectionTable& table,
+                   unsigned int begin, unsigned int end ) {
+
+               system.evaluate( table, begin, end, threads );
+             } );
+  }
+
+  #include "resonanceReconstruction/rmatrix/Reconstructor/src/linearize.hpp"
 };
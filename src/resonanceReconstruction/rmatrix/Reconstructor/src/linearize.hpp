@@ -0,0 +1,236 @@
+/**
+ *  @brief Reconstruct the cross sections on an energy grid on which they can
+ *         be linearly interpolated within the given tolerance, passing the
+ *         results to a sink as they become available
+ *
+ *  The minimal energy grid derived from the resonance parameters (see grid())
+ *  together with the boundaries of the resonance range is used as the seed
+ *  grid. Every interval of the seed grid is then bisected until the cross
+ *  section value of every reaction at the midpoint of each subinterval
+ *  agrees with the linearly interpolated value within the tolerance, i.e.
+ *  until for every reaction:
+ *    | sigma( Em ) - interpolated | <= max( relative * | sigma( Em ) |,
+ *                                         absolute )
+ *  with Em the midpoint of the subinterval.
+ *
+ *  When the compound system can calculate the cross section derivatives (see
+ *  hasDerivatives() on the compound systems), these are evaluated together
+ *  with the cross sections. The midpoint test is still applied to every
+ *  subinterval, but the derivatives at the midpoint are not calculated when
+ *  the cubic Hermite interpolant through the values and derivatives at the
+ *  boundaries of the subinterval indicates that the tolerance is satisfied,
+ *  i.e. when the midpoint is unlikely to become a boundary itself (see
+ *  refine()).
+ *
+ *  The results are passed to the sink in chunks, in increasing energy order,
+ *  as sink( energies, values ) in which energies is a vector of energies (in
+ *  eV) and values is a vector containing the cross section values (in barn)
+ *  at these energies: the first values correspond to the first energy (one
+ *  value for each reaction in the order given by reactionIndex()), the next
+ *  values to the second energy, etc. Every chunk consists of a seed energy
+ *  and the energies added in the following seed interval, the last chunk
+ *  only contains the upper boundary of the resonance range. The vectors are
+ *  only valid during the call to the sink.
+ *
+ *  The seed energies and the intervals of the seed grid are distributed
+ *  dynamically over a pool of threads, each with its own evaluation
+ *  workspace. At most windowSize seed intervals are processed at the same
+ *  time and a chunk is passed to the sink as soon as it and all preceding
+ *  chunks are completed, so that the memory required for the result is
+ *  bounded by the window instead of by the size of the final grid. The sink
+ *  is never called concurrently but it may be called by any of the threads.
+ *  An interval is always refined in the same way, independent of the thread
+ *  processing it, so the chunks are identical to the chunks of the serial
+ *  linearization for any number of threads.
+ *
+ *  @param[in] relative   the relative tolerance
+ *  @param[in] absolute   the absolute tolerance (in barn)
+ *  @param[in] threads    the number of threads (0 for the number of
+ *                        concurrent threads supported by the hardware)
+ *  @param[in] sink       the function receiving the chunks
+ */
+template < typename Sink >
+void linearize( double relative, double absolute,
+                unsigned int threads, Sink&& sink ) const {
+
+  // the seed grid
+  std::vector< double > seed;
+  for ( const auto& energy : this->grid() ) {
+
+    seed.push_back( energy.value );
+  }
+  seed.push_back( this->lowerEnergy().value );
+  seed.push_back( this->upperEnergy().value );
+  std::sort( seed.begin(), seed.end() );
+  seed.erase( std::unique( seed.begin(), seed.end() ), seed.end() );
+
+  std::visit(
+    [&] ( const auto& system ) {
+
+      const unsigned int size = system.reactionIndex().size();
+      const unsigned int number = seed.size();
+
+      threads = numberThreads( threads );
+      std::vector< EvaluationWorkspace > workspaces;
+      workspaces.reserve( threads );
+      for ( unsigned int thread = 0; thread < threads; ++thread ) {
+
+        workspaces.push_back( system.workspace() );
+      }
+
+      // evaluate the seed grid (with the derivatives when available)
+      const bool hermite = system.hasDerivatives();
+      std::vector< double > values( number * size, 0. );
+      std::vector< double > derivatives( hermite ? number * size : 0, 0. );
+      std::vector< std::vector< double > > results(
+          threads, std::vector< double >( size ) );
+      std::vector< std::vector< double > > slopes(
+          threads, std::vector< double >( size ) );
+      parallelFor( 0, number, CrossSectionTable::tileSize, threads,
+                   [&] ( unsigned int thread,
+                         unsigned int first, unsigned int last ) {
+
+                     auto& result = results[ thread ];
+                     auto& slope = slopes[ thread ];
+                     for ( unsigned int i = first; i < last; ++i ) {
+
+                       std::fill( result.begin(), result.end(), 0. );
+                       if ( hermite ) {
+
+                         std::fill( slope.begin(), slope.end(), 0. );
+                         system.evaluate( seed[i] * electronVolt, result,
+                                          slope, workspaces[ thread ] );
+                         std::copy( slope.begin(), slope.end(),
+                                    derivatives.begin() + i * size );
+                       }
+                       else {
+
+                         system.evaluate( seed[i] * electronVolt, result,
+                                          workspaces[ thread ] );
+                       }
+                       std::copy( result.begin(), result.end(),
+                                  values.begin() + i * size );
+                     }
+                   } );
+
+      // refine the intervals of the seed grid one window at a time, the
+      // chunks are passed to the sink in order as soon as they are completed
+      const unsigned int intervals = number - 1;
+      const unsigned int window = std::min( windowSize, intervals );
+      std::vector< std::vector< double > > energies( window );
+      std::vector< std::vector< double > > refined( window );
+      std::vector< bool > completed( window );
+      std::mutex mutex;
+      for ( unsigned int begin = 0; begin < intervals; begin += window ) {
+
+        const unsigned int end = std::min( begin + window, intervals );
+        std::fill( completed.begin(), completed.end(), false );
+        unsigned int next = begin;
+        parallelFor( begin, end, 1, threads,
+                     [&] ( unsigned int thread,
+                           unsigned int first, unsigned int last ) {
+
+                       for ( unsigned int i = first; i < last; ++i ) {
+
+                         auto& chunk = energies[ i - begin ];
+                         auto& chunked = refined[ i - begin ];
+                         chunk.assign( 1, seed[i] );
+                         chunked.assign( values.begin() + i * size,
+                                         values.begin() + ( i + 1 ) * size );
+                         if ( hermite ) {
+
+                           refine( system,
+                                   seed[i], values.data() + i * size,
+                                   derivatives.data() + i * size,
+                                   seed[i + 1],
+                                   values.data() + ( i + 1 ) * size,
+                                   derivatives.data() + ( i + 1 ) * size,
+                                   relative, absolute, workspaces[ thread ],
+                                   chunk, chunked );
+                         }
+                         else {
+
+                           refine( system,
+                                   seed[i], values.data() + i * size,
+                                   seed[i + 1],
+                                   values.data() + ( i + 1 ) * size,
+                                   relative, absolute, workspaces[ thread ],
+                                   chunk, chunked );
+                         }
+
+                         std::lock_guard< std::mutex > lock( mutex );
+                         completed[ i - begin ] = true;
+                         while ( ( next < end ) and
+                                 completed[ next - begin ] ) {
+
+                           sink( energies[ next - begin ],
+                                 refined[ next - begin ] );
+                           ++next;
+                         }
+                       }
+                     } );
+      }
+
+      // the last seed energy
+      sink( std::vector< double >( 1, seed.back() ),
+            std::vector< double >( values.end() - size, values.end() ) );
+    },
+    this->system_ );
+}
+
+/**
+ *  @brief Reconstruct the cross sections on an energy grid on which they can
+ *         be linearly interpolated within the given tolerance
+ *
+ *  See the linearize() function using a sink for more information. The result
+ *  is identical to the result of the serial linearization for any number of
+ *  threads.
+ *
+ *  @param[in] relative   the relative tolerance
+ *  @param[in] absolute   the absolute tolerance (in barn)
+ *  @param[in] threads    the number of threads (0 for the number of
+ *                        concurrent threads supported by the hardware)
+ */
+CrossSectionTable linearize( double relative, double absolute,
+                             unsigned int threads ) const {
+
+  std::vector< Energy > grid;
+  std::vector< double > values;
+  this->linearize( relative, absolute, threads,
+                   [&] ( const std::vector< double >& energies,
+                         const std::vector< double >& chunk ) {
+
+                     for ( const auto energy : energies ) {
+
+                       grid.push_back( energy * electronVolt );
+                     }
+                     values.insert( values.end(), chunk.begin(), chunk.end() );
+                   } );
+
+  CrossSectionTable table( std::move( grid ) );
+  const auto& index = this->reactionIndex();
+  const unsigned int size = index.size();
+  const auto columns = table.columns( index );
+  for ( unsigned int i = 0; i < table.numberEnergies(); ++i ) {
+
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      columns[ slot ][i] = values[ i * size + slot ];
+    }
+  }
+  return table;
+}
+
+/**
+ *  @brief Reconstruct the cross sections on an energy grid on which they can
+ *         be linearly interpolated within the given tolerance
+ *
+ *  This function uses a single thread.
+ *
+ *  @param[in] relative   the relative tolerance
+ *  @param[in] absolute   the absolute tolerance (in barn)
+ */
+CrossSectionTable linearize( double relative, double absolute ) const {
+
+  return this->linearize( relative, absolute, 1 );
+}
@@ -0,0 +1,282 @@
+/**
+ *  @brief Refine an interval until the cross sections can be linearly
+ *         interpolated within the given tolerance
+ *
+ *  The interval is bisected until the cross section value of every reaction
+ *  at the midpoint of each subinterval agrees with the linearly interpolated
+ *  value within the tolerance, i.e. until for every reaction:
+ *    | sigma( Em ) - interpolated | <= max( relative * | sigma( Em ) |,
+ *                                         absolute )
+ *  with Em the midpoint of the subinterval. Subintervals narrower than
+ *  minimumWidth times the energy are not bisected any further. The
+ *  subintervals are processed from left to right so that the energies of the
+ *  points that were added are given in increasing order (the interval
+ *  boundaries themselves are not included).
+ *
+ *  The cross section values (in barn) of the points that were added are
+ *  given in a single array of which the first size values correspond to the
+ *  first energy, the next size values to the second energy, etc.
+ *
+ *  @param[in] system          the compound system
+ *  @param[in] left            the lower boundary of the interval (in eV)
+ *  @param[in] lower           the cross sections at the lower boundary
+ *  @param[in] right           the upper boundary of the interval (in eV)
+ *  @param[in] upper           the cross sections at the upper boundary
+ *  @param[in] relative        the relative tolerance
+ *  @param[in] absolute        the absolute tolerance (in barn)
+ *  @param[in,out] workspace   the evaluation workspace
+ *  @param[out] energies       the energies of the points that were added
+ *  @param[out] values         the cross sections of the points that were
+ *                             added
+ */
+template < typename System >
+static void refine( const System& system,
+                    double left, const double* lower,
+                    double right, const double* upper,
+                    double relative, double absolute,
+                    EvaluationWorkspace& workspace,
+                    std::vector< double >& energies,
+                    std::vector< double >& values ) {
+
+  const unsigned int size = system.reactionIndex().size();
+
+  auto converged = [&] ( const double* lower, const double* middle,
+                         const double* upper ) {
+
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      const double interpolated = 0.5 * ( lower[ slot ] + upper[ slot ] );
+      const double difference = std::abs( middle[ slot ] - interpolated );
+      if ( difference > std::max( relative * std::abs( middle[ slot ] ),
+                                  absolute ) ) {
+
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // the stack of upper boundaries of the subintervals still to be processed
+  // and the cross sections at these energies, the top of the stack is the
+  // upper boundary of the current subinterval
+  std::vector< double > stack( 1, right );
+  std::vector< double > stacked( upper, upper + size );
+  std::vector< double > middle( size );
+
+  std::vector< double > current( lower, lower + size );
+  double energy = left;
+  while ( stack.size() > 0 ) {
+
+    const double next = stack.back();
+    const double* bound = stacked.data() + stacked.size() - size;
+    const double midpoint = 0.5 * ( energy + next );
+
+    bool accept = ( midpoint <= energy ) or ( midpoint >= next ) or
+                  ( next - energy < minimumWidth * midpoint );
+    if ( not accept ) {
+
+      std::fill( middle.begin(), middle.end(), 0. );
+      system.evaluate( midpoint * electronVolt, middle, workspace );
+      accept = converged( current.data(), middle.data(), bound );
+    }
+
+    if ( accept ) {
+
+      // the subinterval is converged: move on to the next one
+      current.assign( bound, bound + size );
+      energy = next;
+      stack.pop_back();
+      stacked.resize( stacked.size() - size );
+      if ( stack.size() > 0 ) {
+
+        energies.push_back( energy );
+        values.insert( values.end(), current.begin(), current.end() );
+      }
+    }
+    else {
+
+      // bisect the subinterval: the midpoint becomes the upper boundary
+      stack.push_back( midpoint );
+      stacked.insert( stacked.end(), middle.begin(), middle.end() );
+    }
+  }
+}
+
+/**
+ *  @brief Refine an interval until the cross sections can be linearly
+ *         interpolated within the given tolerance, using the cross section
+ *         derivatives
+ *
+ *  This is the same refinement as the one using only the cross section
+ *  values: every subinterval is only accepted when the midpoint test is
+ *  satisfied. The derivatives are used to predict whether or not a
+ *  subinterval will have to be bisected so that the derivatives at its
+ *  midpoint are only calculated when they are likely to be needed. A
+ *  subinterval is predicted to be converged when the cubic Hermite
+ *  interpolant through the values and derivatives at the boundaries
+ *  indicates that the linear interpolation is accurate enough, i.e. when for
+ *  every reaction:
+ *    h / 4 max( | sigma'( E0 ) - s |, | sigma'( E1 ) - s | )
+ *        <= max( relative * min( | sigma( E0 ) |, | sigma( E1 ) | ), absolute )
+ *  with h = E1 - E0 the width of the subinterval and s the slope of the
+ *  linear interpolant. The left hand side is an upper bound for the
+ *  difference between the cubic Hermite and linear interpolants on the
+ *  subinterval (at the midpoint, this difference is h ( sigma'( E0 ) -
+ *  sigma'( E1 ) ) / 8). For such a subinterval, only the cross sections are
+ *  evaluated at the midpoint (the derivatives are only calculated afterwards
+ *  when the midpoint test fails after all). For any other subinterval, the
+ *  cross sections and their derivatives are evaluated at the midpoint
+ *  together.
+ *
+ *  The prediction is never used for the interval itself: its boundaries are
+ *  typically resonance energies (at which the derivatives may vanish) so that
+ *  the cubic Hermite interpolant may not be representative for it.
+ *
+ *  @param[in] system            the compound system
+ *  @param[in] left              the lower boundary of the interval (in eV)
+ *  @param[in] lower             the cross sections at the lower boundary
+ *  @param[in] lowerDerivative   the cross section derivatives at the lower
+ *                               boundary
+ *  @param[in] right             the upper boundary of the interval (in eV)
+ *  @param[in] upper             the cross sections at the upper boundary
+ *  @param[in] upperDerivative   the cross section derivatives at the upper
+ *                               boundary
+ *  @param[in] relative          the relative tolerance
+ *  @param[in] absolute          the absolute tolerance (in barn)
+ *  @param[in,out] workspace     the evaluation workspace
+ *  @param[out] energies         the energies of the points that were added
+ *  @param[out] values           the cross sections of the points that were
+ *                               added
+ */
+template < typename System >
+static void refine( const System& system,
+                    double left, const double* lower,
+                    const double* lowerDerivative,
+                    double right, const double* upper,
+                    const double* upperDerivative,
+                    double relative, double absolute,
+                    EvaluationWorkspace& workspace,
+                    std::vector< double >& energies,
+                    std::vector< double >& values ) {
+
+  const unsigned int size = system.reactionIndex().size();
+
+  auto converged = [&] ( const double* lower, const double* middle,
+                         const double* upper ) {
+
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      const double interpolated = 0.5 * ( lower[ slot ] + upper[ slot ] );
+      const double difference = std::abs( middle[ slot ] - interpolated );
+      if ( difference > std::max( relative * std::abs( middle[ slot ] ),
+                                  absolute ) ) {
+
+        return false;
+      }
+    }
+    return true;
+  };
+
+  auto estimated = [&] ( double width,
+                         const double* lower, const double* lowerDerivative,
+                         const double* upper, const double* upperDerivative ) {
+
+    for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+      const double slope = ( upper[ slot ] - lower[ slot ] ) / width;
+      const double difference =
+          0.25 * width * std::max( std::abs( lowerDerivative[ slot ] - slope ),
+                                   std::abs( upperDerivative[ slot ] - slope ) );
+      if ( not ( difference <= std::max( relative *
+                                           std::min( std::abs( lower[ slot ] ),
+                                                     std::abs( upper[ slot ] ) ),
+                                         absolute ) ) ) {
+
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // the stack of upper boundaries of the subintervals still to be processed
+  // and the cross sections and derivatives at these energies, the top of the
+  // stack is the upper boundary of the current subinterval
+  std::vector< double > stack( 1, right );
+  std::vector< double > stacked( upper, upper + size );
+  std::vector< double > stackedDerivatives( upperDerivative,
+                                            upperDerivative + size );
+  std::vector< double > middle( size );
+  std::vector< double > middleDerivative( size );
+
+  std::vector< double > current( lower, lower + size );
+  std::vector< double > currentDerivative( lowerDerivative,
+                                           lowerDerivative + size );
+  double energy = left;
+  while ( stack.size() > 0 ) {
+
+    const double next = stack.back();
+    const double* bound = stacked.data() + stacked.size() - size;
+    const double* boundDerivative = stackedDerivatives.data() +
+                                    stackedDerivatives.size() - size;
+    const double midpoint = 0.5 * ( energy + next );
+
+    bool accept = ( midpoint <= energy ) or ( midpoint >= next ) or
+                  ( next - energy < minimumWidth * midpoint );
+    if ( not accept ) {
+
+      const bool predicted = ( ( energy != left ) or ( next != right ) ) and
+                             estimated( next - energy,
+                                        current.data(),
+                                        currentDerivative.data(),
+                                        bound, boundDerivative );
+
+      std::fill( middle.begin(), middle.end(), 0. );
+      if ( predicted ) {
+
+        // the subinterval is likely converged: the derivatives at the
+        // midpoint are probably not needed
+        system.evaluate( midpoint * electronVolt, middle, workspace );
+        accept = converged( current.data(), middle.data(), bound );
+        if ( not accept ) {
+
+          std::fill( middle.begin(), middle.end(), 0. );
+        }
+      }
+      if ( not accept ) {
+
+        std::fill( middleDerivative.begin(), middleDerivative.end(), 0. );
+        system.evaluate( midpoint * electronVolt, middle, middleDerivative,
+                         workspace );
+        if ( not predicted ) {
+
+          accept = converged( current.data(), middle.data(), bound );
+        }
+      }
+    }
+
+    if ( accept ) {
+
+      // the subinterval is converged: move on to the next one
+      current.assign( bound, bound + size );
+      currentDerivative.assign( boundDerivative, boundDerivative + size );
+      energy = next;
+      stack.pop_back();
+      stacked.resize( stacked.size() - size );
+      stackedDerivatives.resize( stackedDerivatives.size() - size );
+      if ( stack.size() > 0 ) {
+
+        energies.push_back( energy );
+        values.insert( values.end(), current.begin(), current.end() );
+      }
+    }
+    else {
+
+      // bisect the subinterval: the midpoint becomes the upper boundary
+      stack.push_back( midpoint );
+      stacked.insert( stacked.end(), middle.begin(), middle.end() );
+      stackedDerivatives.insert( stackedDerivatives.end(),
+                                 middleDerivative.begin(),
+                                 middleDerivative.end() );
+    }
+  }
+}
@@ -0,0 +1,44 @@
+/**
+ *  @brief Create a cross section table for an energy grid
+ *
+ *  The given function is called for each contiguous run of energies inside
+ *  the resonance range as evaluate( system, table, begin, end ). The cross
+ *  sections for energies outside of the resonance range are set to zero.
+ *
+ *  @param[in] energies   the incident energies
+ *  @param[in] evaluate   the function evaluating a run of energies
+ */
+template < typename Evaluate >
+CrossSectionTable tabulate( std::vector< Energy >&& energies,
+                            Evaluate&& evaluate ) const {
+
+  CrossSectionTable table( std::move( energies ) );
+  const auto grid = table.energies();
+  const unsigned int size = table.numberEnergies();
+
+  auto inside = [&] ( unsigned int i ) {
+
+    return ( grid[i] >= this->lowerEnergy() ) and
+           ( grid[i] <= this->upperEnergy() );
+  };
+
+  std::visit(
+    [&] ( const auto& system ) {
+
+      // evaluate each contiguous run of energies inside the resonance range
+      unsigned int begin = 0;
+      while ( begin < size ) {
+
+        while ( ( begin < size ) and not inside( begin ) ) { ++begin; }
+        unsigned int end = begin;
+        while ( ( end < size ) and inside( end ) ) { ++end; }
+        if ( begin < end ) {
+
+          evaluate( system, table, begin, end );
+        }
+        begin = end;
+      }
+    },
+    this->system_ );
+  return table;
+}
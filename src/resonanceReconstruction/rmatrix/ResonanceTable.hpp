@@ -1,6 +1,14 @@
 /**
  *  @class
  *  @brief Resonance parameters for a specific J,pi value
+ *
+ *  In addition to the resonances themselves, the table stores the resonance
+ *  data required for the R-matrix assembly in packed raw double arrays: the
+ *  resonance energies Er, the squared eliminated widths and the products of
+ *  the reduced widths gamma_c gamma_c' for every channel pair c <= c' (the
+ *  R-matrix is symmetric). The products for a channel pair are stored
+ *  contiguously for all resonances. These arrays are aligned and padded with
+ *  zero values up to a multiple of the number of lanes.
  */
 class ResonanceTable {
 
@@ -8,11 +16,22 @@ class ResonanceTable {
   std::vector< ChannelID > channels_;
   std::vector< Resonance > widths_;
 
+  unsigned int padded_;
+  AlignedVector< double > energies_;
+  AlignedVector< double > eliminated_;
+  AlignedVector< double > products_;
+
   /* auxiliary functions */
   #include "resonanceReconstruction/rmatrix/ResonanceTable/src/verifyTable.hpp"
+  #include "resonanceReconstruction/rmatrix/ResonanceTable/src/pack.hpp"
 
 public:
 
+  /**
+   *  @brief The number of resonances processed together
+   */
+  static constexpr unsigned int lanes = 8;
+
   /* constructor */
   #include "resonanceReconstruction/rmatrix/ResonanceTable/src/ctor.hpp"
 
@@ -45,4 +64,37 @@ public:
              | ranges::view::transform( [] ( const auto& resonance )
                                            { return resonance.energy(); } );
   }
+
+  /**
+   *  @brief Return the size of the packed arrays (the number of resonances
+   *         padded up to a multiple of the number of lanes)
+   */
+  unsigned int paddedSize() const { return this->padded_; }
+
+  /**
+   *  @brief Return the packed resonance energies (in eV)
+   */
+  const double* packedEnergies() const { return this->energies_.data(); }
+
+  /**
+   *  @brief Return the packed squared eliminated widths (in eV)
+   */
+  const double* packedEliminatedWidths() const {
+
+    return this->eliminated_.data();
+  }
+
+  /**
+   *  @brief Return the packed reduced width products gamma_c gamma_c' (in eV)
+   *         for every resonance for a pair of channels
+   *
+   *  @param[in] c        the index of the first channel
+   *  @param[in] cprime   the index of the second channel (c <= cprime)
+   */
+  const double* packedProducts( unsigned int c, unsigned int cprime ) const {
+
+    const unsigned int size = this->numberChannels();
+    const unsigned int pair = c * size - c * ( c - 1 ) / 2 + ( cprime - c );
+    return this->products_.data() + pair * this->padded_;
+  }
 };
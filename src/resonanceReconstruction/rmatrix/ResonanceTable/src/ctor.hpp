@@ -18,5 +18,6 @@ ResonanceTable( std::vector< ChannelID >&& channels,
     widths_( std::move( widths ) ) {
 
     verifyTable( this->channels_, this->widths_ );
+    this->pack();
 }
 
@@ -0,0 +1,34 @@
+/**
+ *  @brief Fill the packed resonance arrays
+ */
+void pack() {
+
+  const unsigned int size = this->numberChannels();
+  const unsigned int number = this->numberResonances();
+  const unsigned int pairs = size * ( size + 1 ) / 2;
+
+  this->padded_ = ( number + lanes - 1 ) / lanes * lanes;
+  this->energies_.assign( this->padded_, 0. );
+  this->eliminated_.assign( this->padded_, 0. );
+  this->products_.assign( pairs * this->padded_, 0. );
+
+  for ( unsigned int r = 0; r < number; ++r ) {
+
+    const auto& resonance = this->widths_[r];
+    const auto widths = resonance.widths();
+    const double eliminated = resonance.eliminatedWidth().value;
+    this->energies_[r] = resonance.energy().value;
+    this->eliminated_[r] = eliminated * eliminated;
+
+    unsigned int pair = 0;
+    for ( unsigned int c = 0; c < size; ++c ) {
+
+      for ( unsigned int cprime = c; cprime < size; ++cprime ) {
+
+        this->products_[ pair * this->padded_ + r ] =
+            widths[c].value * widths[cprime].value;
+        ++pair;
+      }
+    }
+  }
+}
@@ -66,6 +66,44 @@ SCENARIO( "ResonanceTable" ) {
       CHECK( 2 == resonance.widths().size() );
       CHECK( 1.759740e+3 == Approx( resonance.widths()[0].value ) );
       CHECK( 4.000000e-1 == Approx( resonance.widths()[1].value ) );
+
+      CHECK( 8 == ResonanceTable::lanes );
+      CHECK( 8 == table.paddedSize() );
+
+      auto energies = table.packedEnergies();
+      CHECK( 6.823616e+4 == Approx( energies[0] ) );
+      CHECK( 1.150980e+5 == Approx( energies[1] ) );
+      CHECK( 1.825230e+5 == Approx( energies[2] ) );
+
+      auto eliminated = table.packedEliminatedWidths();
+      CHECK( 3.933600e-1 * 3.933600e-1 == Approx( eliminated[0] ) );
+      CHECK( 7.390000e-1 * 7.390000e-1 == Approx( eliminated[1] ) );
+      CHECK( 7.451500e-1 * 7.451500e-1 == Approx( eliminated[2] ) );
+
+      auto products = table.packedProducts( 0, 0 );
+      CHECK( 2.179040e+2 * 2.179040e+2 == Approx( products[0] ) );
+      CHECK( 4.307780e+0 * 4.307780e+0 == Approx( products[1] ) );
+      CHECK( 1.759740e+3 * 1.759740e+3 == Approx( products[2] ) );
+
+      products = table.packedProducts( 0, 1 );
+      CHECK( 2.179040e+2 * 1.000000e-5 == Approx( products[0] ) );
+      CHECK( 0.0 == Approx( products[1] ) );
+      CHECK( 1.759740e+3 * 4.000000e-1 == Approx( products[2] ) );
+
+      products = table.packedProducts( 1, 1 );
+      CHECK( 1.000000e-5 * 1.000000e-5 == Approx( products[0] ) );
+      CHECK( 0.0 == Approx( products[1] ) );
+      CHECK( 4.000000e-1 * 4.000000e-1 == Approx( products[2] ) );
+
+      // the padding resonances have zero widths
+      for ( unsigned int r = 3; r < table.paddedSize(); ++r ) {
+
+        CHECK( 0. == energies[r] );
+        CHECK( 0. == eliminated[r] );
+        CHECK( 0. == table.packedProducts( 0, 0 )[r] );
+        CHECK( 0. == table.packedProducts( 0, 1 )[r] );
+        CHECK( 0. == table.packedProducts( 1, 1 )[r] );
+      }
     } // THEN
   } // GIVEN
 
@@ -9,6 +9,7 @@ class SpinGroup {
   RLMatrixCalculator< Formalism, BoundaryOption > rlmatrix_;
 
   std::vector< ReactionID > reactions_;
+  std::vector< unsigned int > slots_;
   std::vector< unsigned int > incident_;
   std::vector< ParticleChannel > channels_;
   ResonanceTable parameters_;
@@ -18,13 +19,14 @@ class SpinGroup {
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/makeResonanceTable.hpp"
 
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/makeReactionIdentifiers.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/makeReactionSlots.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/determineIncidentChannels.hpp"
 
-  #include "resonanceReconstruction/rmatrix/SpinGroup/src/penetrabilities.hpp"
-  #include "resonanceReconstruction/rmatrix/SpinGroup/src/phaseShifts.hpp"
-  #include "resonanceReconstruction/rmatrix/SpinGroup/src/coulombShifts.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/channelStates.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/sqrtPenetrabilities.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/omegas.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/calculate.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/calculateDerivatives.hpp"
 
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/verifyChannels.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/verifyIncidentChannels.hpp"
@@ -89,12 +91,49 @@ public:
    */
   auto reactionIDs() const { return ranges::view::all( this->reactions_ ); }
 
+  /**
+   *  @brief Return the reaction slots associated to each reaction identifier
+   *
+   *  The order in which these are given equals the order of the reaction
+   *  identifiers given by reactionIDs().
+   */
+  auto reactionSlots() const { return ranges::view::all( this->slots_ ); }
+
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/internReactions.hpp"
+
   /**
    *  @brief Return the resonance table
    */
   const ResonanceTable& resonanceTable() const { return this->parameters_; }
 
+  /**
+   *  @brief Return whether or not the level matrix is used to calculate the
+   *         ( I - RL )^-1 R matrix
+   */
+  bool usesLevelMatrix() const { return this->rlmatrix_.usesLevelMatrix(); }
+
+  /**
+   *  @brief Return whether or not the cross section derivatives can be
+   *         calculated
+   *
+   *  The derivatives are available when all channels have energy independent
+   *  channel radii and none of them involves charged particles.
+   */
+  bool hasDerivatives() const {
+
+    return std::all_of(
+             this->channels_.begin(), this->channels_.end(),
+             [] ( const auto& channel ) {
+
+               return std::visit( [] ( const auto& channel )
+                                     { return channel.hasDerivatives(); },
+                                  channel );
+             } );
+  }
+
   //#include "resonanceReconstruction/rmatrix/SpinGroup/src/switchIncidentPair.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/tabulateCoulombFunctions.hpp"
+  #include "resonanceReconstruction/rmatrix/SpinGroup/src/workspace.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/evaluate.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/evaluateTMatrix.hpp"
   #include "resonanceReconstruction/rmatrix/SpinGroup/src/grid.hpp"
@@ -0,0 +1,141 @@
+/**
+ *  @brief Calculate the cross sections at the given energy using the given
+ *         channel states
+ *
+ *  The accumulate function is called for every cross section value with the
+ *  index of the associated reaction identifier in the spin group.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in] states           the state of each channel at the given energy
+ *  @param[in,out] workspace    the spin group workspace
+ *  @param[in] accumulate       the function accumulating the cross sections
+ */
+template < typename Accumulate >
+void calculate( const Energy& energy,
+                const std::vector< ChannelState >& states,
+                SpinGroupWorkspace& workspace,
+                Accumulate&& accumulate ) const {
+
+  // sqrt(P) and Omega = exp( i(w - phi) ) for each channel
+  const auto diagonalSqrtPMatrix = this->sqrtPenetrabilities( states );
+  const auto diagonalOmegaMatrix = this->omegas( states );
+
+  // calculate the rows of the R_L = ( 1 - RL )^-1 R matrix for the incident
+  // channels (column k contains the row for the kth incident channel)
+  const auto& rlmatrix = this->rlmatrix_( energy,
+                                          this->resonanceTable(),
+                                          states,
+                                          this->channels(),
+                                          this->incident_,
+                                          workspace );
+
+  // the pi/k2 * gJ factor
+  const auto factor = [&] {
+    const unsigned int c = this->incident_.front();
+    const auto waveNumber = states[c].waveNumber;
+    const auto squaredWaveNumber = waveNumber * waveNumber;
+    const auto spinFactor = std::visit(
+        [] ( const auto& channel ) { return channel.statisticalSpinFactor(); },
+        this->channels_[c] );
+    return pi / squaredWaveNumber * spinFactor;
+  }();
+
+  // a lambda to process each incident channel
+  auto processIncidentChannel = [&] ( const unsigned int k ) {
+
+    // the index of the incident channel
+    const unsigned int c = this->incident_[k];
+
+    // lambda to derive a kronecker delta array for the current incident channel
+    const unsigned int size = this->channels().size();
+    auto delta = [c,size] ( const auto value ) {
+      return ranges::view::concat(
+                 ranges::view::repeat_n( 0., c ),
+                 ranges::view::single( value ),
+                 ranges::view::repeat_n( 0., size - c - 1 ) );
+    };
+
+    // the elements of the R_L = ( 1 - RL )^-1 R matrix for the incident channel
+    const auto row = ranges::make_iterator_range(
+                        rlmatrix.data() + k * size,
+                        rlmatrix.data() + ( k + 1 ) * size );
+
+    // the row of the S or U matrix corresponding with the incident channel
+    // S = U = Omega ( I + 2 i P^1/2 ( I - RL )^-1 R P^1/2 ) Omega
+    // S = U = Omega ( I + 2 i P^1/2 R_L P^1/2 ) Omega
+    // S = U = Omega ( I + 2 i T ) Omega
+    // S = U = Omega W Omega
+    const auto incidentSqrtP = diagonalSqrtPMatrix[c];
+    const auto incidentOmega = diagonalOmegaMatrix[c];
+    const auto uElements =
+        ranges::view::zip_with(
+            [&] ( const auto delta, const auto tValue,
+                  const auto sqrtP, const auto omega )
+                { return incidentOmega *
+                         ( delta + std::complex< double >( 0., 2. ) *
+                                   incidentSqrtP * tValue * sqrtP ) * omega; },
+            delta( 1.0 ), row, diagonalSqrtPMatrix, diagonalOmegaMatrix );
+
+    // the exponential of the coulomb phase shift for the incident channel
+    const auto exponential =
+      std::exp( std::complex< double >( 0., states[c].coulombPhaseShift ) );
+
+    // the cross section values for channel c to c' - independent of formalism
+    // sigma_cc' = norm( exp( iw_c ) delta_cc' - U_cc' )
+    const auto sigma =
+      ranges::view::zip_with(
+          [&] ( const auto delta, const auto uValue )
+              { return std::norm( delta - uValue ); },
+          delta( exponential ),
+          uElements );
+
+    // the eliminated capture channel - Reich-Moore only
+    const auto capture =
+      ranges::view::single(
+          ranges::accumulate(
+              uElements | ranges::view::transform(
+                              [] ( const auto value ) -> double
+                                 { return std::norm( value ); } ),
+              1., ranges::minus() ) );
+
+    // concat and multiply by pi / k^2 g_J
+    const auto crossSections =
+      ranges::view::concat( sigma, capture )
+        | ranges::view::transform(
+              [=] ( const auto value ) -> Quantity< Barn >
+                  { return factor * value; } );
+
+    // accumulate results
+    ranges::for_each(
+      ranges::view::zip( ranges::view::iota( 0u ), crossSections ),
+      [&] ( const auto& pair ) -> void
+          { accumulate( std::get< 0 >( pair ), std::get< 1 >( pair ) ); } );
+  };
+
+  // process the incident channels
+  for ( unsigned int k = 0; k < this->incident_.size(); ++k ) {
+
+    processIncidentChannel( k );
+  }
+}
+
+/**
+ *  @brief Calculate the cross sections at the given energy
+ *
+ *  The accumulate function is called for every cross section value with the
+ *  index of the associated reaction identifier in the spin group.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] workspace    the spin group workspace
+ *  @param[in] accumulate       the function accumulating the cross sections
+ */
+template < typename Accumulate >
+void calculate( const Energy& energy, SpinGroupWorkspace& workspace,
+                Accumulate&& accumulate ) const {
+
+  // the state of each channel (wave number, penetrability, shift factor,
+  // phase shift, etc.) except the eliminated capture channel
+  this->channelStates( energy, workspace.states );
+  this->calculate( energy, workspace.states, workspace,
+                   std::forward< Accumulate >( accumulate ) );
+}
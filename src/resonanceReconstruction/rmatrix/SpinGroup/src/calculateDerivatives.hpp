@@ -0,0 +1,145 @@
+/**
+ *  @brief Calculate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  The accumulate function is called for every cross section value and its
+ *  derivative (in barn/eV) with the index of the associated reaction
+ *  identifier in the spin group.
+ *
+ *  With T = P^1/2 ( I - RL )^-1 R P^1/2 and U = Omega ( I + 2iT ) Omega, the
+ *  derivative of U follows from the derivatives of P^1/2, Omega and
+ *  ( I - RL )^-1 R (see RLMatrixCalculator::derivative()), for which the
+ *  complete ( I - RL )^-1 R matrix is calculated instead of only the rows for
+ *  the incident channels. The derivatives of the cross sections
+ *    sigma_cc' = pi / k^2 g_J | exp( iw_c ) delta_cc' - U_cc' |^2
+ *    sigma_capture = pi / k^2 g_J ( 1 - sum_c' | U_cc' |^2 )
+ *  are then obtained using d( pi / k^2 )/dE = - pi / k^2 / E for the incident
+ *  channel.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] workspace    the spin group workspace
+ *  @param[in] accumulate       the function accumulating the cross sections
+ *                              and their derivatives
+ */
+template < typename Accumulate >
+void calculateDerivatives( const Energy& energy,
+                           SpinGroupWorkspace& workspace,
+                           Accumulate&& accumulate ) const {
+
+  // the state of each channel and the derivatives of the penetrability,
+  // shift factor and phase shift
+  this->channelStates( energy, workspace.states );
+  const auto& states = workspace.states;
+
+  auto& derivatives = workspace.derivatives;
+  derivatives.clear();
+  for ( const auto& channel : this->channels() ) {
+
+    derivatives.push_back(
+        std::visit( [&] ( const auto& channel )
+                        { return channel.derivatives( energy ); },
+                    channel ) );
+  }
+
+  // the complete ( 1 - RL )^-1 R matrix and its derivative
+  const auto& rlmatrix = this->rlmatrix_( energy,
+                                          this->resonanceTable(),
+                                          states,
+                                          this->channels(),
+                                          workspace );
+  const auto& rlderivative = this->rlmatrix_.derivative( energy,
+                                                         this->resonanceTable(),
+                                                         states,
+                                                         derivatives,
+                                                         this->channels(),
+                                                         workspace );
+
+  // sqrt(P) and Omega = exp( i(w - phi) ) for each channel and their
+  // derivatives
+  const unsigned int size = states.size();
+  auto sqrtP = [&] ( unsigned int c ) {
+
+    return std::sqrt( states[c].penetrability );
+  };
+  auto sqrtPDerivative = [&] ( unsigned int c ) {
+
+    const double value = sqrtP( c );
+    return value > 0. ? 0.5 * derivatives[c][0] / value : 0.;
+  };
+  auto omega = [&] ( unsigned int c ) {
+
+    return std::exp( std::complex< double >(
+                         0.0, states[c].coulombPhaseShift -
+                              states[c].phaseShift ) );
+  };
+  auto omegaDerivative = [&] ( unsigned int c ) {
+
+    return std::complex< double >( 0.0, -derivatives[c][2] ) * omega( c );
+  };
+
+  // the pi/k2 * gJ factor and its derivative (k2 is proportional to E for the
+  // incident channel)
+  const CrossSection factor = [&] {
+    const unsigned int c = this->incident_.front();
+    const auto waveNumber = states[c].waveNumber;
+    const auto squaredWaveNumber = waveNumber * waveNumber;
+    const auto spinFactor = std::visit(
+        [] ( const auto& channel ) { return channel.statisticalSpinFactor(); },
+        this->channels_[c] );
+    return pi / squaredWaveNumber * spinFactor;
+  }();
+  const double factorDerivative = - factor.value / energy.value;
+
+  // process the incident channels
+  const std::complex< double > twoI( 0., 2. );
+  for ( const auto c : this->incident_ ) {
+
+    const double incidentSqrtP = sqrtP( c );
+    const double incidentSqrtPDerivative = sqrtPDerivative( c );
+    const auto incidentOmega = omega( c );
+    const auto incidentOmegaDerivative = omegaDerivative( c );
+
+    // the exponential of the coulomb phase shift for the incident channel
+    const auto exponential =
+      std::exp( std::complex< double >( 0., states[c].coulombPhaseShift ) );
+
+    double sum = 0.;
+    double sumDerivative = 0.;
+    for ( unsigned int cprime = 0; cprime < size; ++cprime ) {
+
+      const double delta = c == cprime ? 1. : 0.;
+
+      // T = P^1/2 ( I - RL )^-1 R P^1/2 and W = I + 2iT
+      const double outgoingSqrtP = sqrtP( cprime );
+      const double outgoingSqrtPDerivative = sqrtPDerivative( cprime );
+      const auto x = rlmatrix( cprime, c );
+      const auto dx = rlderivative( cprime, c );
+      const auto w = delta + twoI * incidentSqrtP * x * outgoingSqrtP;
+      const auto dw = twoI * ( incidentSqrtPDerivative * x * outgoingSqrtP +
+                               incidentSqrtP * dx * outgoingSqrtP +
+                               incidentSqrtP * x * outgoingSqrtPDerivative );
+
+      // U = Omega W Omega
+      const auto outgoingOmega = omega( cprime );
+      const auto u = incidentOmega * w * outgoingOmega;
+      const auto du = incidentOmegaDerivative * w * outgoingOmega +
+                      incidentOmega * dw * outgoingOmega +
+                      incidentOmega * w * omegaDerivative( cprime );
+
+      // sigma_cc' = norm( exp( iw_c ) delta_cc' - U_cc' )
+      const auto difference = delta * exponential - u;
+      const double sigma = std::norm( difference );
+      const double sigmaDerivative =
+          - 2. * std::real( std::conj( difference ) * du );
+      accumulate( cprime, factor * sigma,
+                  factorDerivative * sigma + factor.value * sigmaDerivative );
+
+      sum += std::norm( u );
+      sumDerivative += 2. * std::real( std::conj( u ) * du );
+    }
+
+    // the eliminated capture channel - Reich-Moore only
+    accumulate( size, factor * ( 1. - sum ),
+                factorDerivative * ( 1. - sum ) - factor.value * sumDerivative );
+  }
+}
@@ -0,0 +1,46 @@
+/**
+ *  @brief Calculate the state of each channel at the given energy
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] states   the channel states (in the order of the channels)
+ */
+void channelStates( const Energy& energy,
+                    std::vector< ChannelState >& states ) const {
+
+  auto state = [&] ( const auto& channel ) { return channel.state( energy ); };
+
+  states.clear();
+  for ( const auto& channel : this->channels() ) {
+
+    states.push_back( std::visit( state, channel ) );
+  }
+}
+
+/**
+ *  @brief Calculate the state of each channel for a range of energies
+ *
+ *  The states are stored channel by channel in the tile of the workspace: the
+ *  state of channel c at energy i (with first <= i < last) is found at index
+ *  c * ( last - first ) + i - first.
+ *
+ *  @param[in] energies        the energy grid
+ *  @param[in] first           the index of the first energy
+ *  @param[in] last            the index past the last energy
+ *  @param[in,out] workspace   the spin group workspace
+ */
+template < typename Energies >
+void channelStates( const Energies& energies,
+                    unsigned int first, unsigned int last,
+                    SpinGroupWorkspace& workspace ) const {
+
+  auto states = [&] ( const auto& channel ) {
+    channel.states( energies, first, last,
+                    workspace.tile, workspace.hardSphere );
+  };
+
+  workspace.tile.clear();
+  for ( const auto& channel : this->channels() ) {
+
+    std::visit( states, channel );
+  }
+}
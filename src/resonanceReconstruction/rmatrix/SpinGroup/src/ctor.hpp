@@ -1,14 +1,19 @@
+private:
+
 /**
- *  @brief Constructor
+ *  @brief Private constructor
  *
- *  @param[in] channels   the channels involved in the spin group
- *  @param[in] table      the table of resonance parameters
+ *  @param[in] calculator   the ( I - RL )^-1 R matrix calculator
+ *  @param[in] channels     the channels involved in the spin group
+ *  @param[in] table        the table of resonance parameters
  */
-SpinGroup( std::vector< ParticleChannel >&& channels,
+SpinGroup( RLMatrixCalculator< Formalism, BoundaryOption >&& calculator,
+           std::vector< ParticleChannel >&& channels,
            ResonanceTable&& table ) :
-  rlmatrix_( table ),
+  rlmatrix_( std::move( calculator ) ),
   reactions_( makeReactionIdentifiers( channels,
                                        Formalism() ) ),
+  slots_( makeReactionSlots( this->reactions_ ) ),
   incident_( determineIncidentChannels( channels ) ),
   channels_( std::move( channels ) ),
   parameters_( std::move( table ) ) {
@@ -18,6 +23,38 @@ SpinGroup( std::vector< ParticleChannel >&& channels,
   verifyResonanceChannels( this->channels_, this->parameters_ );
 }
 
+public:
+
+/**
+ *  @brief Constructor
+ *
+ *  The calculation of the ( I - RL )^-1 R matrix (using the channel matrix or
+ *  the level matrix) is selected using the number of resonances and
+ *  channels in the resonance table.
+ *
+ *  @param[in] channels   the channels involved in the spin group
+ *  @param[in] table      the table of resonance parameters
+ */
+SpinGroup( std::vector< ParticleChannel >&& channels,
+           ResonanceTable&& table ) :
+  SpinGroup( RLMatrixCalculator< Formalism, BoundaryOption >( table ),
+             std::move( channels ), std::move( table ) ) {}
+
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] channels   the channels involved in the spin group
+ *  @param[in] table      the table of resonance parameters
+ *  @param[in] method     the calculation of the ( I - RL )^-1 R matrix to be
+ *                        used (ChannelMatrix or LevelMatrix)
+ */
+template < typename Method >
+SpinGroup( std::vector< ParticleChannel >&& channels,
+           ResonanceTable&& table,
+           Method method ) :
+  SpinGroup( RLMatrixCalculator< Formalism, BoundaryOption >( table, method ),
+             std::move( channels ), std::move( table ) ) {}
+
 /**
  *  @brief Constructor
  *
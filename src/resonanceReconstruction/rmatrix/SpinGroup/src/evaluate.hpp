@@ -1,108 +1,157 @@
 /**
  *  @brief Evaluate the cross sections at the given energy
  *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the accumulated cross sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluate( const Energy& energy,
+               std::map< ReactionID, CrossSection >& result,
+               SpinGroupWorkspace& workspace ) const {
+
+  this->calculate( energy, workspace,
+                   [&] ( unsigned int index, const CrossSection& value )
+                       { result[ this->reactions_[ index ] ] += value; } );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  The cross section values (in barn) are accumulated in a dense array using
+ *  the reaction slots of the spin group (see internReactions()). The array
+ *  must be large enough to contain every slot.
+ *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a dense array containing the accumulated cross
+ *                             sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               SpinGroupWorkspace& workspace ) const {
+
+  this->calculate( energy, workspace,
+                   [&] ( unsigned int index, const CrossSection& value )
+                       { result[ this->slots_[ index ] ] += value.value; } );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  The cross section values (in barn) and their derivatives (in barn/eV) are
+ *  accumulated in dense arrays using the reaction slots of the spin group
+ *  (see internReactions()). The derivatives are calculated analytically
+ *  together with the cross sections, which requires energy independent
+ *  channel radii and channels without charged particles (see
+ *  hasDerivatives()).
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ *  @param[in,out] workspace    the spin group workspace
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative,
+               SpinGroupWorkspace& workspace ) const {
+
+  this->calculateDerivatives(
+      energy, workspace,
+      [&] ( unsigned int index, const CrossSection& value, double slope ) {
+
+        result[ this->slots_[ index ] ] += value.value;
+        derivative[ this->slots_[ index ] ] += slope;
+      } );
+}
+
+/**
+ *  @brief Evaluate the cross sections for a range of energies
+ *
+ *  The channel states for all energies in [first, last) are calculated at
+ *  once (see channelStates()) before the cross sections are calculated for
+ *  each energy. The cross section values (in barn) for the energy with index
+ *  i are accumulated in the dense array results[ i - first ] using the
+ *  reaction slots of the spin group. The values are identical to the ones
+ *  obtained by evaluating each energy individually.
+ *
+ *  @param[in] energies        the energy grid
+ *  @param[in] first           the index of the first energy
+ *  @param[in] last            the index past the last energy
+ *  @param[in,out] results     a dense array containing the accumulated cross
+ *                             sections for each energy
+ *  @param[in,out] workspace   the spin group workspace
+ */
+template < typename Energies >
+void evaluate( const Energies& energies,
+               unsigned int first, unsigned int last,
+               std::vector< std::vector< double > >& results,
+               SpinGroupWorkspace& workspace ) const {
+
+  this->channelStates( energies, first, last, workspace );
+
+  const unsigned int size = last - first;
+  const unsigned int number = this->channels_.size();
+  for ( unsigned int i = 0; i < size; ++i ) {
+
+    workspace.states.clear();
+    for ( unsigned int c = 0; c < number; ++c ) {
+
+      workspace.states.push_back( workspace.tile[ c * size + i ] );
+    }
+
+    auto& result = results[i];
+    this->calculate( energies[ first + i ], workspace.states, workspace,
+                     [&] ( unsigned int index, const CrossSection& value )
+                         { result[ this->slots_[ index ] ] += value.value; } );
+  }
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
  *  @param[in] energy       the incident energy
  *  @param[in,out] result   a map containing the accumulated cross sections
  */
 void evaluate( const Energy& energy,
-               std::map< ReactionID, CrossSection >& result ) {
-
-  // penetrability, Coulomb phase shift, sqrt(P) and Omega = exp( i(w - phi) )
-  // for each channel except the eliminated capture channel
-  const auto penetrabilities = this->penetrabilities( energy );
-  const auto coulombShifts = this->coulombShifts( energy );
-  const auto diagonalSqrtPMatrix = this->sqrtPenetrabilities( penetrabilities );
-  const auto diagonalOmegaMatrix = this->omegas( energy, coulombShifts );
-
-  // calculate the R_L = ( 1 - RL )^-1 R matrix
-  auto rlmatrix = this->rlmatrix_( energy,
-                                   this->resonanceTable(),
-                                   penetrabilities,
-                                   this->channels() );
-
-  // the pi/k2 * gJ factor
-  const auto factor = [&] {
-    auto factor = [&] ( const auto& channel ) {
-      const auto waveNumber = channel.waveNumber( energy );
-      const auto squaredWaveNumber = waveNumber * waveNumber;
-      const auto spinFactor = channel.statisticalSpinFactor();
-      return pi / squaredWaveNumber * spinFactor;
-    };
-    return std::visit( factor, this->channels_[ this->incident_.front() ] );
-  }();
-
-  // the cross section identifiers
-  const auto identifiers = this->reactionIDs();
-
-  // a lambda to process each incident channel
-  auto processIncidentChannel = [&] ( const unsigned int c ) {
-
-    // lambda to derive a kronecker delta array for the current incident channel
-    const unsigned int size = this->channels().size();
-    auto delta = [c,size] ( const auto value ) {
-      return ranges::view::concat(
-                 ranges::view::repeat_n( 0., c ),
-                 ranges::view::single( value ),
-                 ranges::view::repeat_n( 0., size - c - 1 ) );
-    };
-
-    // the elements of the R_L = ( 1 - RL )^-1 R matrix for the incident channel
-    const auto row = ranges::make_iterator_range(
-                        rlmatrix.data() + c * size,
-                        rlmatrix.data() + ( c + 1 ) * size );
-
-    // the row of the S or U matrix corresponding with the incident channel
-    // S = U = Omega ( I + 2 i P^1/2 ( I - RL )^-1 R P^1/2 ) Omega
-    // S = U = Omega ( I + 2 i P^1/2 R_L P^1/2 ) Omega
-    // S = U = Omega ( I + 2 i T ) Omega
-    // S = U = Omega W Omega
-    const auto incidentSqrtP = diagonalSqrtPMatrix[c];
-    const auto incidentOmega = diagonalOmegaMatrix[c];
-    const auto uElements =
-        ranges::view::zip_with(
-            [&] ( const auto delta, const auto tValue,
-                  const auto sqrtP, const auto omega )
-                { return incidentOmega *
-                         ( delta + std::complex< double >( 0., 2. ) *
-                                   incidentSqrtP * tValue * sqrtP ) * omega; },
-            delta( 1.0 ), row, diagonalSqrtPMatrix, diagonalOmegaMatrix );
-
-    // the exponential of the coulomb phase shift for the incident channel
-    const auto exponential =
-      std::exp( std::complex< double >( 0., coulombShifts[c] ) );
-
-    // the cross section values for channel c to c' - independent of formalism
-    // sigma_cc' = norm( exp( iw_c ) delta_cc' - U_cc' )
-    const auto sigma =
-      ranges::view::zip_with(
-          [&] ( const auto delta, const auto uValue )
-              { return std::norm( delta - uValue ); },
-          delta( exponential ),
-          uElements );
-
-    // the eliminated capture channel - Reich-Moore only
-    const auto capture =
-      ranges::view::single(
-          ranges::accumulate(
-              uElements | ranges::view::transform(
-                              [] ( const auto value ) -> double
-                                 { return std::norm( value ); } ),
-              1., ranges::minus() ) );
-
-    // concat and multiply by pi / k^2 g_J
-    const auto crossSections =
-      ranges::view::concat( sigma, capture )
-        | ranges::view::transform(
-              [=] ( const auto value ) -> Quantity< Barn >
-                  { return factor * value; } );
-
-    // accumulate results in the map
-    ranges::for_each(
-      ranges::view::zip( identifiers, crossSections ),
-      [&] ( const auto& pair ) -> void
-          { result[ std::get< 0 >( pair ) ] += std::get< 1 >( pair ); } );
-  };
-
-  // process the incident channels
-  ranges::for_each( this->incident_, processIncidentChannel );
+               std::map< ReactionID, CrossSection >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a dense array containing the accumulated cross
+ *                          sections
+ */
+void evaluate( const Energy& energy, std::vector< double >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, derivative, workspace );
 }
@@ -6,23 +6,28 @@
  *  R matrix and L is a diagonal matrix defined as S - B + iP with S the shift
  *  factor and B the boundary condition of the channel.
  *
- *  @param[in] energy       the incident energy
- *  @param[in,out] result   a map containing the matrix elements
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the matrix elements
+ *  @param[in,out] workspace   the spin group workspace
  */
 void evaluateTMatrix(
          const Energy& energy,
-         std::map< ReactionChannelID, std::complex< double > >& result ) {
+         std::map< ReactionChannelID, std::complex< double > >& result,
+         SpinGroupWorkspace& workspace ) const {
 
-  // penetrability, sqrt(P) and channel identifiers for each channel
-  const auto penetrabilities = this->penetrabilities( energy );
-  const auto diagonalSqrtPMatrix = this->sqrtPenetrabilities( penetrabilities );
+  // the state of each channel, sqrt(P) and channel identifiers for each
+  // channel
+  const auto& states = workspace.states;
+  this->channelStates( energy, workspace.states );
+  const auto diagonalSqrtPMatrix = this->sqrtPenetrabilities( states );
   const auto channels = this->channelIDs();
 
   // calculate the R_L = ( 1 - RL )^-1 R matrix
-  auto rlmatrix = this->rlmatrix_( energy,
-                                   this->resonanceTable(),
-                                   penetrabilities,
-                                   this->channels() );
+  const auto& rlmatrix = this->rlmatrix_( energy,
+                                          this->resonanceTable(),
+                                          states,
+                                          this->channels(),
+                                          workspace );
 
   // a lambda to process each channel
   const unsigned int size = channels.size();
@@ -64,3 +69,19 @@ void evaluateTMatrix(
   const unsigned int start = 0;
   ranges::for_each( ranges::view::indices( start, size ), processChannel );
 }
+
+/**
+ *  @brief Evaluate the elements of the T or X matrix at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a map containing the matrix elements
+ */
+void evaluateTMatrix(
+         const Energy& energy,
+         std::map< ReactionChannelID, std::complex< double > >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluateTMatrix( energy, result, workspace );
+}
@@ -16,10 +16,17 @@ std::vector< Energy > grid() const {
                     { return 2. * p * gamma * gamma; };
   auto totalWidth = [&] ( const auto& resonance ) -> Width {
 
+    auto penetrability = [&] ( const auto& channel )
+                             { return channel.penetrability(
+                                          resonance.energy() ); };
     auto widths = ranges::view::zip_with(
                       toWidth,
                       resonance.widths(),
-                      this->penetrabilities( resonance.energy() ) );
+                      this->channels()
+                        | ranges::view::transform(
+                              [&] ( const auto& channel )
+                                  { return std::visit( penetrability,
+                                                       channel ); } ) );
 
     Width total = 2. * resonance.eliminatedWidth()
                      * resonance.eliminatedWidth();
@@ -0,0 +1,16 @@
+/**
+ *  @brief Add the reactions of the spin group to a reaction index
+ *
+ *  The reaction slots used by the spin group are replaced by the slots
+ *  assigned by the reaction index. This is done by the compound system so
+ *  that all spin groups share the same slots.
+ *
+ *  @param[in,out] index   the reaction index
+ */
+void internReactions( ReactionIndex& index ) {
+
+  for ( unsigned int i = 0; i < this->reactions_.size(); ++i ) {
+
+    this->slots_[i] = index.intern( this->reactions_[i] );
+  }
+}
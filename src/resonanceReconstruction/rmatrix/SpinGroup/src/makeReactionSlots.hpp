@@ -0,0 +1,13 @@
+static
+std::vector< unsigned int >
+makeReactionSlots( const std::vector< ReactionID >& reactions ) {
+
+  ReactionIndex index;
+  std::vector< unsigned int > slots;
+  slots.reserve( reactions.size() );
+  for ( const auto& reaction : reactions ) {
+
+    slots.push_back( index.intern( reaction ) );
+  }
+  return slots;
+}
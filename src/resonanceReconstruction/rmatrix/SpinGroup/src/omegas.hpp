@@ -1,8 +1,9 @@
-template < typename Range >
-auto omegas( const Energy& energy, const Range& coulombShifts ) const {
+auto omegas( const std::vector< ChannelState >& states ) const {
 
-  return ranges::view::zip_with(
-             [] ( const double w, const double phi )
-                { return std::exp( std::complex< double >( 0.0, w - phi ) ); },
-             coulombShifts, this->phaseShifts( energy ) );
+  return states
+             | ranges::view::transform(
+                   [] ( const ChannelState& state )
+                      { return std::exp( std::complex< double >(
+                                   0.0, state.coulombPhaseShift -
+                                        state.phaseShift ) ); } );
 }
@@ -1,8 +1,7 @@
-template < typename Range >
-auto sqrtPenetrabilities( const Range& penetrabilities ) const {
+auto sqrtPenetrabilities( const std::vector< ChannelState >& states ) const {
 
-  return penetrabilities
+  return states
              | ranges::view::transform(
-                   [] ( const double penetrability ) -> double
-                      { return std::sqrt( penetrability ); } );
+                   [] ( const ChannelState& state ) -> double
+                      { return std::sqrt( state.penetrability ); } );
 }
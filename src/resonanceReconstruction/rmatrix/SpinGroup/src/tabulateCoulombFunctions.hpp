@@ -0,0 +1,19 @@
+/**
+ *  @brief Tabulate the penetrability, shift factor and phase shift of the
+ *         charged particle channels in the spin group over an energy interval
+ *
+ *  @param[in] lower       the lower energy of the interval
+ *  @param[in] upper       the upper energy of the interval
+ *  @param[in] tolerance   the tolerance on the interpolated values
+ */
+void tabulateCoulombFunctions( const Energy& lower, const Energy& upper,
+                               double tolerance ) {
+
+  for ( auto& channel : this->channels_ ) {
+
+    std::visit( [&] ( auto& channel )
+                    { channel.tabulateCoulombFunctions( lower, upper,
+                                                        tolerance ); },
+                channel );
+  }
+}
@@ -0,0 +1,19 @@
+/**
+ *  @brief Return a workspace for the evaluation of the spin group
+ */
+SpinGroupWorkspace workspace() const {
+
+  const unsigned int size = this->parameters_.numberChannels();
+
+  SpinGroupWorkspace workspace;
+  workspace.rmatrix.setZero( size, size );
+  workspace.rlmatrix.setZero( size, size );
+  workspace.lmatrix.resize( size );
+  workspace.lmatrix.setZero();
+  workspace.states.reserve( this->channels_.size() );
+  workspace.open.reserve( this->channels_.size() );
+  workspace.blocks.reserve( this->channels_.size() );
+  workspace.position.reserve( this->channels_.size() );
+  workspace.columns.reserve( this->channels_.size() );
+  return workspace;
+}
@@ -440,6 +440,9 @@ void verifySpinGroup( const SpinGroup< ReichMoore, ShiftFactor >& group ) {
   CHECK( 2.0 == Approx( resonance.widths()[1].value ) );
   CHECK( 3.0 == Approx( resonance.widths()[2].value ) );
 
+  // three channels: the fixed size channel matrix calculation is used
+  CHECK( false == group.usesLevelMatrix() );
+
   // grid information
   auto grid = group.grid();
   CHECK( 3 == grid.size() );
@@ -897,6 +897,39 @@ SCENARIO( "evaluate" ) {
       CHECK( 6.042426e+0 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "cross sections can be calculated for a range of energies" ) {
+
+      std::vector< Energy > energies = {
+          1e-5 * electronVolt, 1e-3 * electronVolt, 1e+0 * electronVolt,
+          1e+1 * electronVolt, 1.541700e+1 * electronVolt,
+          3.232700e+1 * electronVolt, 4.753400e+1 * electronVolt,
+          1e+2 * electronVolt, 2e+3 * electronVolt };
+      const unsigned int first = 2;
+      const unsigned int last = energies.size();
+
+      auto verify = [&] ( const auto& group ) {
+
+        const auto slots = group.reactionSlots();
+        const unsigned int size =
+            *std::max_element( slots.begin(), slots.end() ) + 1;
+
+        auto workspace = group.workspace();
+        std::vector< std::vector< double > >
+            results( last - first, std::vector< double >( size, 0. ) );
+        group.evaluate( energies, first, last, results, workspace );
+
+        for ( unsigned int i = first; i < last; ++i ) {
+
+          std::vector< double > xs( size, 0. );
+          group.evaluate( energies[i], xs );
+          CHECK( xs == results[ i - first ] );
+        }
+      };
+
+      verify( group2 );
+      verify( group4 );
+    } // THEN
   } // GIVEN
 
   GIVEN( "valid data for a SpinGroup with a resonance at a negative energy" ) {
@@ -1739,4 +1772,98 @@ SCENARIO( "evaluate" ) {
       xs.clear();
     } // THEN
   } // GIVEN*/
+
+  GIVEN( "valid data for a SpinGroup with one eliminated capture channel, "
+         "two elastic channels with l = 1 and l = 3 and a fission channel" ) {
+
+    // the parameters used in this test are not based on an evaluation: they
+    // are chosen so that the energy dependence of the penetrability, shift
+    // factor and phase shift for l > 0 contributes to the derivatives (the
+    // penetrability and shift factor use a different radius than the phase
+    // shift)
+
+    // particles
+    Particle neutron( ParticleID( "n" ), neutronMass,
+                      0.0 * elementary, 0.5, +1);
+    Particle cl35( ParticleID( "Cl35" ), 3.466845e+1 * neutronMass,
+                   17.0 * elementary, 1.5, +1);
+
+    // particle pairs
+    ParticlePair in( neutron, cl35 );
+    ParticlePair out( neutron, cl35, ParticlePairID( "fission" ) );
+
+    // channels
+    Channel< Neutron > elastic1( in, in, 0. * electronVolt, { 1, 1.0, 2.0, -1 },
+                                 { 4.822220e-1 * rootBarn,
+                                   3.667980e-1 * rootBarn },
+                                 -1.0 );
+    Channel< Neutron > elastic3( in, in, 0. * electronVolt, { 3, 2.0, 2.0, -1 },
+                                 { 4.822220e-1 * rootBarn,
+                                   3.667980e-1 * rootBarn },
+                                 -3.0 );
+    Channel< Fission > fission( in, out, "fission1", 0. * electronVolt,
+                                { 1, 1.0, 2.0, -1 },
+                                { 4.822220e-1 * rootBarn,
+                                  3.667980e-1 * rootBarn },
+                                0.0 );
+
+    // resonance table
+    ResonanceTable table(
+      { elastic1.channelID(), elastic3.channelID(), fission.channelID() },
+      { Resonance( 2.0e+4 * electronVolt,
+                   { 40. * rootElectronVolt, 10. * rootElectronVolt,
+                     1. * rootElectronVolt },
+                   1.5 * rootElectronVolt ),
+        Resonance( 5.0e+4 * electronVolt,
+                   { 20. * rootElectronVolt, 30. * rootElectronVolt,
+                     2. * rootElectronVolt },
+                   2. * rootElectronVolt ),
+        Resonance( 1.2e+5 * electronVolt,
+                   { 10. * rootElectronVolt, 15. * rootElectronVolt,
+                     3. * rootElectronVolt },
+                   1. * rootElectronVolt ) } );
+    ResonanceTable table2 = table;
+
+    SpinGroup< ReichMoore, ShiftFactor >
+        group1( { elastic1, elastic3, fission }, std::move( table ) );
+    SpinGroup< ReichMoore, Constant >
+        group2( { elastic1, elastic3, fission }, std::move( table2 ) );
+
+    THEN( "cross section derivatives can be calculated" ) {
+
+      auto verify = [&] ( const auto& group ) {
+
+        CHECK( true == group.hasDerivatives() );
+
+        const auto slots = group.reactionSlots();
+        const unsigned int size =
+            *std::max_element( slots.begin(), slots.end() ) + 1;
+
+        for ( double energy : { 1.99e+4, 2.001e+4, 4.9e+4, 5.2e+4, 1.21e+5 } ) {
+
+          std::vector< double > xs( size, 0. );
+          std::vector< double > values( size, 0. );
+          std::vector< double > derivatives( size, 0. );
+          group.evaluate( energy * electronVolt, xs );
+          group.evaluate( energy * electronVolt, values, derivatives );
+
+          // compare with a central finite difference
+          const double h = 1e-6 * energy;
+          std::vector< double > upper( size, 0. );
+          std::vector< double > lower( size, 0. );
+          group.evaluate( ( energy + h ) * electronVolt, upper );
+          group.evaluate( ( energy - h ) * electronVolt, lower );
+          for ( unsigned int slot = 0; slot < size; ++slot ) {
+
+            CHECK( xs[ slot ] == Approx( values[ slot ] ) );
+            CHECK( ( upper[ slot ] - lower[ slot ] ) / ( 2. * h ) ==
+                   Approx( derivatives[ slot ] ).epsilon( 1e-5 ) );
+          }
+        }
+      };
+
+      verify( group1 );
+      verify( group2 );
+    } // THEN
+  } // GIVEN
 } // SCENARIO
@@ -2396,4 +2396,168 @@ SCENARIO( "evaluateTMatrix" ) {
       CHECK(  2.4179854102688846E-13 == Approx( elements[ t22 ].imag() ) );
     } // THEN
   } // GIVEN
+
+  GIVEN( "valid data for a SpinGroup with channels that are not coupled by "
+         "any resonance" ) {
+
+    // test based on the Fe54 resonance data used above, with an additional
+    // (fictitious) inelastic channel so that the spin group contains
+    // independent channel blocks
+
+    // particles
+    Particle neutron( ParticleID( "n" ), neutronMass,
+                      0.0 * elementary, 0.5, +1);
+    Particle fe54( ParticleID( "Fe54" ), 5.347624e+1 * neutronMass,
+                   26.0 * elementary, 0.0, +1);
+    Particle fe54_e1( ParticleID( "Fe54_e1" ), 5.347624e+1 * neutronMass,
+                      26.0 * elementary, 0.0, +1);
+
+    // particle pairs
+    ParticlePair in( neutron, fe54 );
+    ParticlePair out( neutron, fe54_e1 );
+
+    // channels
+    Channel< Neutron > elastic( in, in, 0.0 * electronVolt, { 0, 0.5, 0.5, +1 },
+                                { 5.437300e-1 * rootBarn,
+                                  5.437300e-1 * rootBarn },
+                                0.0 );
+    Channel< Neutron > inelastic( in, out, -1.0e+3 * electronVolt,
+                                  { 0, 0.5, 0.5, +1 },
+                                  { 5.437300e-1 * rootBarn,
+                                    5.437300e-1 * rootBarn },
+                                  0.0 );
+
+    // conversion from Gamma to gamma
+    auto eGamma = [&] ( double width, const Energy& energy ) -> ReducedWidth {
+      return std::sqrt( width / 2. / elastic.penetrability( energy ) ) *
+             rootElectronVolt;
+    };
+    auto cGamma = [&] ( double width ) -> ReducedWidth {
+      return std::sqrt( width / 2. ) * rootElectronVolt;
+    };
+    ReducedWidth zero = 0.0 * rootElectronVolt;
+
+    // the elastic channel only
+    ResonanceTable single(
+      { elastic.channelID() },
+      { Resonance( 7.788000e+3 * electronVolt,
+                   { eGamma( 1.187354e+3, 7.788000e+3 * electronVolt ) },
+                   cGamma( 1.455000e+0 ) ) } );
+
+    // the inelastic channel has no width
+    ResonanceTable widthless(
+      { elastic.channelID(), inelastic.channelID() },
+      { Resonance( 7.788000e+3 * electronVolt,
+                   { eGamma( 1.187354e+3, 7.788000e+3 * electronVolt ),
+                     zero },
+                   cGamma( 1.455000e+0 ) ) } );
+
+    // the channels are not coupled by any of the resonances
+    ResonanceTable uncoupled(
+      { elastic.channelID(), inelastic.channelID() },
+      { Resonance( 7.788000e+3 * electronVolt,
+                   { eGamma( 1.187354e+3, 7.788000e+3 * electronVolt ),
+                     zero },
+                   cGamma( 1.455000e+0 ) ),
+        Resonance( 5.287200e+4 * electronVolt,
+                   { zero,
+                     eGamma( 2.000345e+3, 5.287200e+4 * electronVolt ) },
+                   cGamma( 2.000000e+0 ) ) } );
+
+    // the channels are coupled by one of the resonances
+    ResonanceTable coupled(
+      { elastic.channelID(), inelastic.channelID() },
+      { Resonance( 7.788000e+3 * electronVolt,
+                   { eGamma( 1.187354e+3, 7.788000e+3 * electronVolt ),
+                     eGamma( 1.187354e+3, 7.788000e+3 * electronVolt ) },
+                   cGamma( 1.455000e+0 ) ),
+        Resonance( 5.287200e+4 * electronVolt,
+                   { zero,
+                     eGamma( 2.000345e+3, 5.287200e+4 * electronVolt ) },
+                   cGamma( 2.000000e+0 ) ) } );
+    ResonanceTable coupled2 = coupled;
+
+    SpinGroup< ReichMoore, ShiftFactor > group1( { elastic },
+                                                 std::move( single ) );
+    SpinGroup< ReichMoore, ShiftFactor > group2( { elastic, inelastic },
+                                                 std::move( widthless ) );
+    SpinGroup< ReichMoore, ShiftFactor > group3( { elastic, inelastic },
+                                                 std::move( uncoupled ) );
+    SpinGroup< ReichMoore, ShiftFactor > group4( { elastic, inelastic },
+                                                 std::move( coupled ),
+                                                 ChannelMatrix() );
+    SpinGroup< ReichMoore, ShiftFactor > group5( { elastic, inelastic },
+                                                 std::move( coupled2 ),
+                                                 LevelMatrix() );
+
+    ReactionChannelID t11( "n,Fe54{0,1/2,1/2+}->n,Fe54{0,1/2,1/2+}" );
+    ReactionChannelID t12( "n,Fe54{0,1/2,1/2+}->n,Fe54_e1{0,1/2,1/2+}" );
+    ReactionChannelID t21( "n,Fe54_e1{0,1/2,1/2+}->n,Fe54{0,1/2,1/2+}" );
+    ReactionChannelID t22( "n,Fe54_e1{0,1/2,1/2+}->n,Fe54_e1{0,1/2,1/2+}" );
+
+    THEN( "T matrix elements for a channel without widths are zero" ) {
+
+      for ( auto energy : { 1e-5 * electronVolt, 1e+2 * electronVolt,
+                            7.788e+3 * electronVolt, 1e+5 * electronVolt } ) {
+
+        std::map< ReactionChannelID, std::complex< double > > reference;
+        std::map< ReactionChannelID, std::complex< double > > elements;
+        group1.evaluateTMatrix( energy, reference );
+        group2.evaluateTMatrix( energy, elements );
+        CHECK( 4 == elements.size() );
+        CHECK( reference[ t11 ].real() == Approx( elements[ t11 ].real() ) );
+        CHECK( reference[ t11 ].imag() == Approx( elements[ t11 ].imag() ) );
+        CHECK( 0. == elements[ t12 ] );
+        CHECK( 0. == elements[ t21 ] );
+        CHECK( 0. == elements[ t22 ] );
+      }
+    } // THEN
+
+    THEN( "T matrix elements for uncoupled channels are calculated for each "
+          "channel block separately" ) {
+
+      for ( auto energy : { 1e-5 * electronVolt, 1e+2 * electronVolt,
+                            7.788e+3 * electronVolt, 1e+5 * electronVolt } ) {
+
+        std::map< ReactionChannelID, std::complex< double > > reference;
+        std::map< ReactionChannelID, std::complex< double > > elements;
+        group1.evaluateTMatrix( energy, reference );
+        group3.evaluateTMatrix( energy, elements );
+        CHECK( 4 == elements.size() );
+        CHECK( reference[ t11 ].real() == Approx( elements[ t11 ].real() ) );
+        CHECK( reference[ t11 ].imag() == Approx( elements[ t11 ].imag() ) );
+        CHECK( 0. == elements[ t12 ] );
+        CHECK( 0. == elements[ t21 ] );
+      }
+
+      // the inelastic channel is only open above its threshold
+      std::map< ReactionChannelID, std::complex< double > > elements;
+      group3.evaluateTMatrix( 1e+2 * electronVolt, elements );
+      CHECK( 0. == elements[ t22 ] );
+      group3.evaluateTMatrix( 1e+5 * electronVolt, elements );
+      CHECK( 0. != elements[ t22 ] );
+    } // THEN
+
+    THEN( "T matrix elements calculated using the channel matrix and the level "
+          "matrix are the same" ) {
+
+      CHECK( false == group4.usesLevelMatrix() );
+      CHECK( true == group5.usesLevelMatrix() );
+
+      for ( auto energy : { 1e-5 * electronVolt, 1e+2 * electronVolt,
+                            7.788e+3 * electronVolt, 1e+5 * electronVolt } ) {
+
+        std::map< ReactionChannelID, std::complex< double > > reference;
+        std::map< ReactionChannelID, std::complex< double > > elements;
+        group4.evaluateTMatrix( energy, reference );
+        group5.evaluateTMatrix( energy, elements );
+        CHECK( 4 == elements.size() );
+        for ( const auto& id : { t11, t12, t21, t22 } ) {
+
+          CHECK( reference[ id ].real() == Approx( elements[ id ].real() ) );
+          CHECK( reference[ id ].imag() == Approx( elements[ id ].imag() ) );
+        }
+      }
+    } // THEN
+  } // GIVEN
 } // SCENARIO
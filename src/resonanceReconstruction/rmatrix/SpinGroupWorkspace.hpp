@@ -0,0 +1,78 @@
+/**
+ *  @class
+ *  @brief Scratch data used during the evaluation of a single spin group
+ *
+ *  A workspace contains the intermediate values calculated for a spin group
+ *  at a given energy. Keeping these values outside of the spin group allows
+ *  a single spin group to be evaluated concurrently by multiple threads, as
+ *  long as every thread uses its own workspace.
+ *
+ *  Not every spin group uses every field: the R-matrix spin groups use the
+ *  matrices while the legacy resolved spin groups use the resonance arrays.
+ *  A workspace for a given spin group should be obtained from the workspace()
+ *  function of that spin group.
+ */
+struct SpinGroupWorkspace {
+
+  /* fields - R-matrix spin groups */
+  Matrix< std::complex< double > > rmatrix;
+  Matrix< std::complex< double > > rlmatrix;
+  DiagonalMatrix< std::complex< double > > lmatrix;
+  Eigen::PartialPivLU< Matrix< std::complex< double > > > lu;
+
+  /* fields - R-matrix spin groups (the state of each channel at the current
+     energy) */
+  std::vector< ChannelState > states;
+
+  /* fields - R-matrix spin groups (the state of each channel for every energy
+     in a tile of energies, stored channel by channel, and scratch space for
+     the hard sphere functions) */
+  std::vector< ChannelState > tile;
+  AlignedVector< double > hardSphere;
+
+  /* fields - R-matrix spin groups (the indices of the coupled channels above
+     threshold grouped per channel block, the end of each block and the
+     position of each channel in the list of open channels, and the requested
+     columns, R and L matrix and ( I - RL )^-1 R columns for a single block
+     when the system is not solved as a whole) */
+  std::vector< unsigned int > open;
+  std::vector< unsigned int > blocks;
+  std::vector< unsigned int > position;
+  std::vector< unsigned int > columns;
+  Matrix< std::complex< double > > rblock;
+  DiagonalMatrix< std::complex< double > > lblock;
+  Matrix< std::complex< double > > compact;
+
+  /* fields - R-matrix spin groups (the inverse level matrix and the reduced
+     widths of the requested columns when the level matrix is used, the
+     solutions are stored in the compact matrix) */
+  Matrix< std::complex< double > > amatrix;
+  Matrix< std::complex< double > > levels;
+
+  /* fields - R-matrix spin groups (the derivatives of the penetrability,
+     shift factor and phase shift of each channel, the derivatives of the
+     R, L and ( I - RL )^-1 R matrices and ( I - RL )^-1 = I + ( I - RL )^-1 RL
+     when the cross section derivatives are calculated) */
+  std::vector< std::array< double, 3 > > derivatives;
+  Matrix< std::complex< double > > rderivative;
+  DiagonalMatrix< std::complex< double > > lderivative;
+  Matrix< std::complex< double > > rlderivative;
+  Matrix< std::complex< double > > inverse;
+
+  /* fields - R-matrix spin groups (real and imaginary part of the resonance
+     weights 1 / ( Er - E - i Gamma / 2 ) for each resonance, in 1/eV) */
+  AlignedVector< double > real;
+  AlignedVector< double > imaginary;
+
+  /* fields - partial cross section values of the spin group (dense array
+     indexed by reaction slot, used for concurrent spin group evaluation) */
+  std::vector< double > crossSections;
+
+  /* fields - legacy resolved spin groups (the elastic and total width, the
+     distance to the primed resonance energy and the resonance denominator
+     for each resonance, in eV and eV^2) */
+  AlignedVector< double > elastic;
+  AlignedVector< double > total;
+  AlignedVector< double > delta;
+  AlignedVector< double > denominator;
+};
@@ -1,13 +1,13 @@
 namespace legacy {
 
+  // data collections for the legacy resolved and unresolved resonances
+  #include "resonanceReconstruction/rmatrix/legacy/Data.hpp"
+
   // base class for resonances
   #include "resonanceReconstruction/rmatrix/legacy/ResonanceTableBase.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/SpinGroupBase.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase.hpp"
 
-  // data collections for the legacy resolved and unresolved resonances
-  #include "resonanceReconstruction/rmatrix/legacy/Data.hpp"
-
   // legacy resolved and unresolved resonance reconstruction
   #include "resonanceReconstruction/rmatrix/legacy/resolved.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/unresolved.hpp"
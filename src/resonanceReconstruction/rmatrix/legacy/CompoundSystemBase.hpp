@@ -11,10 +11,15 @@ class CompoundSystemBase {
   /* fields */
   std::vector< SpinGroupType > groups_;
   unsigned int lmax_;
+  ReactionIndex index_;
+  unsigned int elastic_;
 
   /* auxiliary functions */
   #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/getLMax.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/verifySpinGroups.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/makeReactionIndex.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/potentialScattering.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/fill.hpp"
 
 public:
 
@@ -26,5 +31,28 @@ public:
    */
   auto spinGroups() const { return ranges::view::all( this->groups_ ); }
 
+  /**
+   *  @brief Return the reaction index
+   *
+   *  The reaction index gives the reaction identifier associated to each slot
+   *  of the dense cross section array used in evaluate().
+   */
+  const ReactionIndex& reactionIndex() const { return this->index_; }
+
+  /**
+   *  @brief Return whether or not the cross section derivatives can be
+   *         calculated
+   *
+   *  The derivatives are available when the channel radii of all l,J pairs
+   *  are energy independent.
+   */
+  bool hasDerivatives() const {
+
+    return std::all_of( this->groups_.begin(), this->groups_.end(),
+                        [] ( const auto& group )
+                           { return group.incidentChannel().hasDerivatives(); } );
+  }
+
+  #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/workspace.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/CompoundSystemBase/src/evaluate.hpp"
 };
@@ -8,6 +8,8 @@ CompoundSystemBase( std::vector< SpinGroupType >&& groups,
   groups_( std::move( groups ) ), lmax_( lmax ) {
 
     verifySpinGroups( this->groups_ );
+    this->index_ = makeReactionIndex( this->groups_ );
+    this->elastic_ = this->index_.slot( this->elasticID() );
   }
 
 
@@ -1,36 +1,232 @@
 /**
  *  @brief Evaluate the cross sections at the given energy
  *
- *  @param[in] energy       the incident energy
- *  @param[in,out] result   a map containing the accumulated cross sections
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the accumulated cross sections
+ *  @param[in,out] workspace   the evaluation workspace (obtained through the
+ *                             workspace() function)
  */
 void evaluate( const Energy& energy,
-               std::map< ReactionID, CrossSection >& result ) {
+               std::map< ReactionID, CrossSection >& result,
+               EvaluationWorkspace& workspace ) const {
 
   // accumulate over each spin group
-  ranges::for_each( this->groups_,
-                    [&] ( auto& group )
-                        { group.evaluate( energy, result ); } );
+  for ( unsigned int i = 0; i < this->groups_.size(); ++i ) {
+
+    this->groups_[i].evaluate( energy, result, workspace.spinGroup( i ) );
+  }
+
+  // accumulate potential scattering
+  result[ this->elasticID() ] += this->potentialScattering( energy );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  The cross section values (in barn) are accumulated in a dense array
+ *  indexed by the slots of the reaction index. The array must contain at
+ *  least reactionIndex().size() values.
+ *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a dense array containing the accumulated cross
+ *                             sections
+ *  @param[in,out] workspace   the evaluation workspace (obtained through the
+ *                             workspace() function)
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               EvaluationWorkspace& workspace ) const {
 
-  // calculate potential scattering
-  const auto channel = this->groups_.front().incidentChannel();
-  const auto incident = channel.particlePair().particle().particleID();
-  const auto target = channel.particlePair().residual().particleID();
-  const auto waveNumber = channel.waveNumber( energy );
-  const auto ratio = waveNumber * channel.radii().phaseShiftRadius( energy );
+  // accumulate over each spin group
+  for ( unsigned int i = 0; i < this->groups_.size(); ++i ) {
 
-  // the 4 * pi / k2 factor
-  const CrossSection factor =  4. * pi / ( waveNumber * waveNumber );
+    this->groups_[i].evaluate( energy, result, workspace.spinGroup( i ) );
+  }
 
   // accumulate potential scattering
-  double value = 0;
-  for ( unsigned int l = 0; l <= this->lmax_; ++l ) {
+  result[ this->elastic_ ] += this->potentialScattering( energy ).value;
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a map containing the accumulated cross sections
+ */
+void evaluate( const Energy& energy,
+               std::map< ReactionID, CrossSection >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a dense array containing the accumulated cross
+ *                          sections
+ */
+void evaluate( const Energy& energy, std::vector< double >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections for a range of energies in a table
+ *
+ *  @param[in,out] table       the cross section table
+ *  @param[in] begin           the index of the first energy to be evaluated
+ *  @param[in] end             the index past the last energy to be evaluated
+ *  @param[in,out] workspace   the evaluation workspace (obtained through the
+ *                             workspace() function)
+ */
+void evaluate( CrossSectionTable& table,
+               unsigned int begin, unsigned int end,
+               EvaluationWorkspace& workspace ) const {
+
+  this->fill( table.energies(), table.columns( this->reactionIndex() ),
+              begin, end, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections for a range of energies in a table
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in,out] table   the cross section table
+ *  @param[in] begin       the index of the first energy to be evaluated
+ *  @param[in] end         the index past the last energy to be evaluated
+ */
+void evaluate( CrossSectionTable& table,
+               unsigned int begin, unsigned int end ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( table, begin, end, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections for a range of energies in a table
+ *         using multiple threads
+ *
+ *  The energies are distributed dynamically over the threads in chunks of
+ *  CrossSectionTable::tileSize energies and every thread uses its own
+ *  workspace. The cross section values at a given energy do not depend on
+ *  the chunk or thread used to calculate them, so the result is identical to
+ *  the result of the serial evaluation for any number of threads.
+ *
+ *  @param[in,out] table   the cross section table
+ *  @param[in] begin       the index of the first energy to be evaluated
+ *  @param[in] end         the index past the last energy to be evaluated
+ *  @param[in] threads     the number of threads (0 for the number of
+ *                         concurrent threads supported by the hardware)
+ */
+void evaluate( CrossSectionTable& table,
+               unsigned int begin, unsigned int end,
+               unsigned int threads ) const {
+
+  // all reactions are added to the table before any thread starts writing
+  const auto energies = table.energies();
+  const auto columns = table.columns( this->reactionIndex() );
+
+  threads = numberThreads( threads );
+  std::vector< EvaluationWorkspace > workspaces;
+  workspaces.reserve( threads );
+  for ( unsigned int thread = 0; thread < threads; ++thread ) {
+
+    workspaces.push_back( this->workspace() );
+  }
+
+  parallelFor( begin, end, CrossSectionTable::tileSize, threads,
+               [&] ( unsigned int thread,
+                     unsigned int first, unsigned int last ) {
+
+                 this->fill( energies, columns, first, last,
+                             workspaces[ thread ] );
+               } );
+}
+
+/**
+ *  @brief Evaluate the cross sections on an energy grid
+ *
+ *  @param[in] energies   the incident energies
+ */
+CrossSectionTable evaluate( std::vector< Energy > energies ) const {
+
+  CrossSectionTable table( std::move( energies ) );
+  this->evaluate( table, 0, table.numberEnergies() );
+  return table;
+}
+
+/**
+ *  @brief Evaluate the cross sections on an energy grid using multiple
+ *         threads
+ *
+ *  @param[in] energies   the incident energies
+ *  @param[in] threads    the number of threads (0 for the number of
+ *                        concurrent threads supported by the hardware)
+ */
+CrossSectionTable evaluate( std::vector< Energy > energies,
+                            unsigned int threads ) const {
+
+  CrossSectionTable table( std::move( energies ) );
+  this->evaluate( table, 0, table.numberEnergies(), threads );
+  return table;
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  The cross section values (in barn) and their derivatives (in barn/eV) are
+ *  accumulated in dense arrays indexed by the slots of the reaction index.
+ *  Both arrays must contain at least reactionIndex().size() values. The
+ *  derivatives are calculated analytically together with the cross sections,
+ *  which requires energy independent channel radii.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ *  @param[in,out] workspace    the evaluation workspace (obtained through the
+ *                              workspace() function)
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative,
+               EvaluationWorkspace& workspace ) const {
+
+  // accumulate over each spin group
+  for ( unsigned int i = 0; i < this->groups_.size(); ++i ) {
 
-    const double phi = calculatePhaseShift< Neutron >( l, ratio, 0. );
-    const double sinphi = std::sin( phi );
-    const double sin2phi = sinphi * sinphi;
-    value += ( 2. * l + 1. ) * sin2phi;
+    this->groups_[i].evaluate( energy, result, derivative,
+                               workspace.spinGroup( i ) );
   }
 
-  result[ ReactionID( incident, target, elementary::ReactionType( "elastic" ) ) ] += factor * value;
+  // accumulate potential scattering
+  result[ this->elastic_ ] += this->potentialScattering( energy ).value;
+  derivative[ this->elastic_ ] += this->potentialScatteringDerivative( energy );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, derivative, workspace );
 }
@@ -0,0 +1,10 @@
+static
+ReactionIndex makeReactionIndex( std::vector< SpinGroupType >& groups ) {
+
+  ReactionIndex index;
+  for ( auto& group : groups ) {
+
+    group.internReactions( index );
+  }
+  return index;
+}
@@ -0,0 +1,74 @@
+/**
+ *  @brief Return the elastic reaction identifier for the compound system
+ */
+ReactionID elasticID() const {
+
+  const auto channel = this->groups_.front().incidentChannel();
+  const auto incident = channel.particlePair().particle().particleID();
+  const auto target = channel.particlePair().residual().particleID();
+  return ReactionID( incident, target, elementary::ReactionType( "elastic" ) );
+}
+
+/**
+ *  @brief Return the potential scattering cross section at the given energy
+ *
+ *  @param[in] energy   the incident energy
+ */
+CrossSection potentialScattering( const Energy& energy ) const {
+
+  const auto channel = this->groups_.front().incidentChannel();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto ratio = waveNumber * channel.radii().phaseShiftRadius( energy );
+
+  // the 4 * pi / k2 factor
+  const CrossSection factor =  4. * pi / ( waveNumber * waveNumber );
+
+  // accumulate potential scattering
+  double value = 0;
+  for ( unsigned int l = 0; l <= this->lmax_; ++l ) {
+
+    const double phi = calculatePhaseShift< Neutron >( l, ratio, 0. );
+    const double sinphi = std::sin( phi );
+    const double sin2phi = sinphi * sinphi;
+    value += ( 2. * l + 1. ) * sin2phi;
+  }
+
+  return factor * value;
+}
+
+/**
+ *  @brief Return the derivative of the potential scattering cross section
+ *         with respect to the incident energy at the given energy
+ *
+ *  The derivative of the phase shift is given by dphi/dE = P / ( 2 E ) for
+ *  energy independent channel radii, with P the penetrability calculated
+ *  using the phase shift radius.
+ *
+ *  @param[in] energy   the incident energy
+ *
+ *  @return the derivative (in barn/eV)
+ */
+double potentialScatteringDerivative( const Energy& energy ) const {
+
+  const auto channel = this->groups_.front().incidentChannel();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto ratio = waveNumber * channel.radii().phaseShiftRadius( energy );
+
+  // the 4 * pi / k2 factor (k2 is proportional to E)
+  const CrossSection factor =  4. * pi / ( waveNumber * waveNumber );
+
+  // accumulate potential scattering and its derivative
+  double value = 0;
+  double derivative = 0;
+  for ( unsigned int l = 0; l <= this->lmax_; ++l ) {
+
+    const double phi = calculatePhaseShift< Neutron >( l, ratio, 0. );
+    const double p = calculatePenetrability< Neutron >( l, ratio, 0. );
+    const double sinphi = std::sin( phi );
+    const double sin2phi = sinphi * sinphi;
+    value += ( 2. * l + 1. ) * sin2phi;
+    derivative += ( 2. * l + 1. ) * std::sin( 2. * phi ) * p;
+  }
+
+  return factor.value * ( 0.5 * derivative - value ) / energy.value;
+}
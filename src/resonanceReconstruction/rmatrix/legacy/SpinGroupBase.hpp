@@ -8,6 +8,7 @@ template < typename ResonanceTableType > class SpinGroupBase {
   Channel< Neutron > incident_;
   ResonanceTableType table_;
   std::array< ReactionID, 3 > reactions_;
+  std::array< unsigned int, 3 > slots_;
 
 protected:
 
@@ -15,6 +16,67 @@ protected:
   const ReactionID& captureID() const { return this->reactions_[1]; }
   const ReactionID& fissionID() const { return this->reactions_[2]; }
 
+  unsigned int elasticSlot() const { return this->slots_[0]; }
+  unsigned int captureSlot() const { return this->slots_[1]; }
+  unsigned int fissionSlot() const { return this->slots_[2]; }
+
+  /**
+   *  @brief Accumulate the cross sections of the l,J pair in a map
+   *
+   *  @param[in] values       the elastic, capture and fission cross sections
+   *  @param[in,out] result   a map containing the accumulated cross sections
+   */
+  void accumulate( const Data< CrossSection >& values,
+                   std::map< ReactionID, CrossSection >& result ) const {
+
+    result[ this->elasticID() ] += values.elastic;
+    result[ this->captureID() ] += values.capture;
+    if ( values.hasFission() ) {
+
+      result[ this->fissionID() ] += values.fission;
+    }
+  }
+
+  /**
+   *  @brief Accumulate the cross sections of the l,J pair in a dense array
+   *
+   *  @param[in] values       the elastic, capture and fission cross sections
+   *  @param[in,out] result   a dense array containing the accumulated cross
+   *                          sections (in barn)
+   */
+  void accumulate( const Data< CrossSection >& values,
+                   std::vector< double >& result ) const {
+
+    result[ this->elasticSlot() ] += values.elastic.value;
+    result[ this->captureSlot() ] += values.capture.value;
+    if ( values.hasFission() ) {
+
+      result[ this->fissionSlot() ] += values.fission.value;
+    }
+  }
+
+  /**
+   *  @brief Accumulate the cross section derivatives of the l,J pair in a
+   *         dense array
+   *
+   *  @param[in] values       the elastic, capture and fission cross section
+   *                          derivatives (in barn/eV)
+   *  @param[in,out] result   a dense array containing the accumulated cross
+   *                          section derivatives (in barn/eV)
+   */
+  void accumulate( const Data< double >& values,
+                   std::vector< double >& result ) const {
+
+    result[ this->elasticSlot() ] += values.elastic;
+    result[ this->captureSlot() ] += values.capture;
+    if ( values.hasFission() ) {
+
+      result[ this->fissionSlot() ] += values.fission;
+    }
+  }
+
+  #include "resonanceReconstruction/rmatrix/legacy/SpinGroupBase/src/channelDerivatives.hpp"
+
 public:
 
   /* constructor */
@@ -36,7 +98,8 @@ public:
         return {{ ReactionID{ incident, target, ReactionType( "elastic" ) },
                   ReactionID{ incident, target, ReactionType( "capture" ) },
                   ReactionID{ incident, target, ReactionType( "fission" ) } }};
-      }( incident ) ) {}
+      }( incident ) ),
+    slots_( {{ 0, 1, 2 }} ) {}
 
   /* methods */
 
@@ -69,4 +132,39 @@ public:
    *  @brief Return the resonance table
    */
   const ResonanceTableType& resonanceTable() const { return this->table_; }
+
+  /**
+   *  @brief Return a workspace for the evaluation of the l,J pair
+   */
+  SpinGroupWorkspace workspace() const { return SpinGroupWorkspace(); }
+
+  /**
+   *  @brief Return whether or not the l,J pair has fission widths
+   */
+  bool hasFission() const {
+
+    return ranges::any_of(
+             this->resonanceTable().resonances(),
+             [] ( const auto& resonance )
+                { return resonance.fission() != Width(); } );
+  }
+
+  /**
+   *  @brief Add the reactions of the l,J pair to a reaction index
+   *
+   *  The elastic and capture reactions are always added, the fission reaction
+   *  is only added when the l,J pair has fission widths. The reaction slots
+   *  used by the l,J pair are replaced by the slots assigned by the index.
+   *
+   *  @param[in,out] index   the reaction index
+   */
+  void internReactions( ReactionIndex& index ) {
+
+    this->slots_[0] = index.intern( this->elasticID() );
+    this->slots_[1] = index.intern( this->captureID() );
+    if ( this->hasFission() ) {
+
+      this->slots_[2] = index.intern( this->fissionID() );
+    }
+  }
 };
@@ -0,0 +1,13 @@
+/**
+ *  @brief Return the derivatives of the penetrability, shift factor and phase
+ *         shift of the incident channel with respect to the incident energy
+ *
+ *  @param[in] energy   the incident energy
+ *
+ *  @return the derivatives of the penetrability, shift factor and phase shift
+ *          (in 1/eV)
+ */
+std::array< double, 3 > channelDerivatives( const Energy& energy ) const {
+
+  return this->incidentChannel().derivatives( energy );
+}
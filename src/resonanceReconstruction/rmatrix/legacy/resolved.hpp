@@ -3,6 +3,7 @@ namespace resolved {
   // resolved resonance data
   #include "resonanceReconstruction/rmatrix/legacy/resolved/Resonance.hpp"
   using ResonanceTable = ResonanceTableBase< resolved::Resonance >;
+  #include "resonanceReconstruction/rmatrix/legacy/resolved/ResonanceConstants.hpp"
 
   // resolved spin group and compound system
   #include "resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup.hpp"
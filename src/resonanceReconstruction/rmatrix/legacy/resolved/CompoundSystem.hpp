@@ -17,6 +17,9 @@ public:
 
   /* methods */
   using CompoundSystemBase< SpinGroup< Formalism > >::spinGroups;
+  using CompoundSystemBase< SpinGroup< Formalism > >::reactionIndex;
+  using CompoundSystemBase< SpinGroup< Formalism > >::workspace;
+  using CompoundSystemBase< SpinGroup< Formalism > >::hasDerivatives;
   using CompoundSystemBase< SpinGroup< Formalism > >::evaluate;
 
   #include "resonanceReconstruction/rmatrix/legacy/resolved/CompoundSystem/src/grid.hpp"
@@ -103,6 +103,19 @@ SCENARIO( "evaluate" ) {
       CHECK( 42264.081005233311 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "cross sections can be calculated using the reaction slots" ) {
+
+      const auto& index = system.reactionIndex();
+      CHECK( 2 == index.size() );
+      CHECK( 0 == index.slot( elas ) );
+      CHECK( 1 == index.slot( capt ) );
+
+      std::vector< double > xs( index.size(), 0. );
+      system.evaluate( 1e-5 * electronVolt, xs );
+      CHECK( 9075.762 == Approx( xs[0] ) );
+      CHECK( 801565.16324338294 == Approx( xs[1] ) );
+    } // THEN
   } // GIVEN
 
   GIVEN( "Rh105 resolved resonance data using MLBW" ) {
@@ -206,5 +219,52 @@ SCENARIO( "evaluate" ) {
       CHECK( 42264.081005233311 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "cross sections can be calculated on an energy grid" ) {
+
+      auto table = system.evaluate( { 1e-5 * electronVolt,
+                                      1. * electronVolt,
+                                      5. * electronVolt } );
+      CHECK( 3 == table.numberEnergies() );
+      CHECK( 2 == table.numberReactions() );
+
+      auto elastic = table.values( elas );
+      CHECK( 3 == elastic.size() );
+      CHECK( 5268.5966369331500 == Approx( elastic[0] ) );
+      CHECK( 2723.0907713948382 == Approx( elastic[1] ) );
+      CHECK( 185939.51714628452 == Approx( elastic[2] ) );
+
+      auto capture = table.values( capt );
+      CHECK( 3 == capture.size() );
+      CHECK( 801565.16324338294 == Approx( capture[0] ) );
+      CHECK( 2161.1909561504717 == Approx( capture[1] ) );
+      CHECK( 87782.287793509589 == Approx( capture[2] ) );
+    } // THEN
+
+    THEN( "cross section derivatives can be calculated" ) {
+
+      const unsigned int size = system.reactionIndex().size();
+      for ( double energy : { 1e-2, 1., 4.755, 5., 5.245, 1e+2 } ) {
+
+        std::vector< double > xs( size, 0. );
+        std::vector< double > values( size, 0. );
+        std::vector< double > derivatives( size, 0. );
+        system.evaluate( energy * electronVolt, xs );
+        system.evaluate( energy * electronVolt, values, derivatives );
+        CHECK( xs[0] == Approx( values[0] ) );
+        CHECK( xs[1] == Approx( values[1] ) );
+
+        // compare with a central finite difference
+        const double h = 1e-6 * energy;
+        std::vector< double > upper( size, 0. );
+        std::vector< double > lower( size, 0. );
+        system.evaluate( ( energy + h ) * electronVolt, upper );
+        system.evaluate( ( energy - h ) * electronVolt, lower );
+        CHECK( ( upper[0] - lower[0] ) / ( 2. * h ) ==
+               Approx( derivatives[0] ).epsilon( 1e-5 ) );
+        CHECK( ( upper[1] - lower[1] ) / ( 2. * h ) ==
+               Approx( derivatives[1] ).epsilon( 1e-5 ) );
+      }
+    } // THEN
   } // GIVEN
 } // SCENARIO
@@ -0,0 +1,86 @@
+/**
+ *  @class
+ *  @brief The energy independent resonance constants for an l,J spin group
+ *         using SLBW or MLBW, stored as a structure of arrays
+ *
+ *  For every resonance, the following values (in eV) are stored in separate
+ *  contiguous arrays of raw double values:
+ *    - the primed resonance energy for a zero shift factor:
+ *        Er + S(Er) GN / ( 2 P(Er) )
+ *    - the shift factor coefficient: GN / ( 2 P(Er) )
+ *    - the reduced elastic width: GN / P(Er)
+ *    - the capture width GG and fission width GF
+ *    - the reduced competitive width: GX / P(Er - QX)
+ *
+ *  With these, the energy dependent values at an energy E with penetrability
+ *  P(E), P(E - QX) and shift factor S(E) are given by:
+ *    Gn(E) = P(E) GN / P(Er)
+ *    Gt(E) = Gn(E) + GG + GF + P(E - QX) GX / P(Er - QX)
+ *    E - Er'(E) = E - Er - ( S(Er) - S(E) ) GN / ( 2 P(Er) )
+ *
+ *  The arrays are aligned and padded up to a multiple of the number of lanes
+ *  with resonances that have zero widths (and thus do not contribute to the
+ *  cross sections), so that they can be processed in blocks without a
+ *  remainder loop.
+ */
+class ResonanceConstants {
+
+  /* fields */
+  unsigned int size_;
+  AlignedVector< double > energy_;
+  AlignedVector< double > shift_;
+  AlignedVector< double > elastic_;
+  AlignedVector< double > capture_;
+  AlignedVector< double > fission_;
+  AlignedVector< double > competition_;
+
+public:
+
+  /**
+   *  @brief The number of resonances processed together
+   */
+  static constexpr unsigned int lanes = 8;
+
+  /* constructor */
+  #include "resonanceReconstruction/rmatrix/legacy/resolved/ResonanceConstants/src/ctor.hpp"
+
+  /**
+   *  @brief Return the number of resonances
+   */
+  unsigned int numberResonances() const { return this->size_; }
+
+  /**
+   *  @brief Return the size of the arrays (a multiple of the number of lanes)
+   */
+  unsigned int paddedSize() const { return this->energy_.size(); }
+
+  /**
+   *  @brief Return the primed resonance energies for a zero shift factor
+   */
+  const double* energy() const { return this->energy_.data(); }
+
+  /**
+   *  @brief Return the shift factor coefficients
+   */
+  const double* shift() const { return this->shift_.data(); }
+
+  /**
+   *  @brief Return the reduced elastic widths
+   */
+  const double* elastic() const { return this->elastic_.data(); }
+
+  /**
+   *  @brief Return the capture widths
+   */
+  const double* capture() const { return this->capture_.data(); }
+
+  /**
+   *  @brief Return the fission widths
+   */
+  const double* fission() const { return this->fission_.data(); }
+
+  /**
+   *  @brief Return the reduced competitive widths
+   */
+  const double* competition() const { return this->competition_.data(); }
+};
@@ -0,0 +1,28 @@
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] table   the table of resonance parameters for the l,J pair
+ */
+ResonanceConstants( const ResonanceTable& table ) :
+    size_( table.numberResonances() ) {
+
+  const unsigned int padded = ( this->size_ + lanes - 1 ) / lanes * lanes;
+  this->energy_.resize( padded, 0. );
+  this->shift_.resize( padded, 0. );
+  this->elastic_.resize( padded, 0. );
+  this->capture_.resize( padded, 0. );
+  this->fission_.resize( padded, 0. );
+  this->competition_.resize( padded, 0. );
+
+  const auto& resonances = table.resonances();
+  for ( unsigned int r = 0; r < this->size_; ++r ) {
+
+    const auto& resonance = resonances[r];
+    this->energy_[r] = resonance.energyPrime( 0. ).value;
+    this->shift_[r] = 0.5 * resonance.elastic( 1. ).value;
+    this->elastic_[r] = resonance.elastic( 1. ).value;
+    this->capture_[r] = resonance.capture().value;
+    this->fission_[r] = resonance.fission().value;
+    this->competition_[r] = resonance.competition( 1. ).value;
+  }
+}
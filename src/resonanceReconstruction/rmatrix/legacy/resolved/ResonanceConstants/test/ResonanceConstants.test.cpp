@@ -0,0 +1,63 @@
+#define CATCH_CONFIG_MAIN
+
+#include "catch.hpp"
+#include "resonanceReconstruction.hpp"
+
+using namespace njoy::resonanceReconstruction;
+
+// convenience typedefs
+using Resonance = rmatrix::legacy::resolved::Resonance;
+using ResonanceTable = rmatrix::legacy::resolved::ResonanceTable;
+using ResonanceConstants = rmatrix::legacy::resolved::ResonanceConstants;
+
+SCENARIO( "ResonanceConstants" ) {
+
+  GIVEN( "valid data for a ResonanceConstants" ) {
+
+    ResonanceTable table(
+      { Resonance( 1000. * electronVolt, 1. * electronVolt,
+                   2. * electronVolt, .5 * electronVolt, 3. * electronVolt,
+                   2., 1.5, -1. ),
+        Resonance( -50. * electronVolt, 4. * electronVolt,
+                   1. * electronVolt, 0. * electronVolt, 0. * electronVolt,
+                   .5, 1., 2. ) } );
+
+    THEN( "a ResonanceConstants can be constructed" ) {
+
+      ResonanceConstants constants( table );
+
+      CHECK( 8 == ResonanceConstants::lanes );
+      CHECK( 2 == constants.numberResonances() );
+      CHECK( 8 == constants.paddedSize() );
+
+      CHECK( 999.75 == Approx( constants.energy()[0] ) );
+      CHECK( .25 == Approx( constants.shift()[0] ) );
+      CHECK( .5 == Approx( constants.elastic()[0] ) );
+      CHECK( 2. == Approx( constants.capture()[0] ) );
+      CHECK( .5 == Approx( constants.fission()[0] ) );
+      CHECK( 2. == Approx( constants.competition()[0] ) );
+
+      CHECK( -42. == Approx( constants.energy()[1] ) );
+      CHECK( 4. == Approx( constants.shift()[1] ) );
+      CHECK( 8. == Approx( constants.elastic()[1] ) );
+      CHECK( 1. == Approx( constants.capture()[1] ) );
+      CHECK( 0. == Approx( constants.fission()[1] ) );
+      CHECK( 0. == Approx( constants.competition()[1] ) );
+
+      // the padding resonances have zero widths
+      for ( unsigned int r = 2; r < constants.paddedSize(); ++r ) {
+
+        CHECK( 0. == constants.energy()[r] );
+        CHECK( 0. == constants.shift()[r] );
+        CHECK( 0. == constants.elastic()[r] );
+        CHECK( 0. == constants.capture()[r] );
+        CHECK( 0. == constants.fission()[r] );
+        CHECK( 0. == constants.competition()[r] );
+      }
+
+      // the arrays are aligned
+      CHECK( 0 == reinterpret_cast< std::uintptr_t >( constants.energy() ) % 64 );
+      CHECK( 0 == reinterpret_cast< std::uintptr_t >( constants.elastic() ) % 64 );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
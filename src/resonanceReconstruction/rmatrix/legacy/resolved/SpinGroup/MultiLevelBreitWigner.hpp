@@ -8,6 +8,9 @@
 template <>
 class SpinGroup< MultiLevelBreitWigner > : protected SpinGroup< SingleLevelBreitWigner > {
 
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/MultiLevelBreitWigner/src/interference.hpp"
+
 public:
 
   /* constructor */
@@ -18,8 +21,11 @@ public:
   using SpinGroup< SingleLevelBreitWigner >::orbitalAngularMomentum;
   using SpinGroup< SingleLevelBreitWigner >::totalAngularMomentum;
   using SpinGroup< SingleLevelBreitWigner >::resonanceTable;
+  using SpinGroup< SingleLevelBreitWigner >::hasFission;
+  using SpinGroup< SingleLevelBreitWigner >::internReactions;
   using SpinGroup< SingleLevelBreitWigner >::QX;
   using SpinGroup< SingleLevelBreitWigner >::grid;
+  using SpinGroup< SingleLevelBreitWigner >::workspace;
 
   #include "resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/MultiLevelBreitWigner/src/evaluate.hpp"
 };
@@ -1,40 +1,150 @@
 /**
  *  @brief Evaluate the cross sections at the given energy using MLBW
  *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the accumulated cross sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluate( const Energy& energy,
+               std::map< ReactionID, CrossSection >& result,
+               SpinGroupWorkspace& workspace ) const {
+
+  // calculate the SLBW cross sections and the resonance crossterm
+  this->accumulate( this->crossSections< true, false >( energy, workspace ),
+                    result );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using MLBW
+ *
+ *  The cross section values (in barn) are accumulated in a dense array using
+ *  the reaction slots of the l,J pair (see internReactions()).
+ *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a dense array containing the accumulated cross
+ *                             sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               SpinGroupWorkspace& workspace ) const {
+
+  // calculate the SLBW cross sections and the resonance crossterm
+  this->accumulate( this->crossSections< true, false >( energy, workspace ),
+                    result );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using MLBW
+ *
+ *  This function uses a temporary workspace.
+ *
  *  @param[in] energy       the incident energy
  *  @param[in,out] result   a map containing the accumulated cross sections
  */
 void evaluate( const Energy& energy,
-               std::map< ReactionID, CrossSection >& result ) {
-
-  // data we need: k, P, phi, rho, g_J
-  const auto channel = this->incidentChannel();
-  const auto waveNumber = channel.waveNumber( energy );
-  const auto spinFactor = channel.statisticalSpinFactor();
-
-  // the pi / k2 factor
-  const CrossSection factor = pi / ( waveNumber * waveNumber ) * spinFactor;
-
-  // calculate the SLBW cross sections
-  SpinGroup< SingleLevelBreitWigner >::evaluate( energy, result );
-
-  // add the elastic cross term for MLBW
-  double term = 0.;
-  unsigned int nr = this->resonanceTable().resonances().size();
-  auto elastic = this->elastic();
-  auto total = this->total();
-  auto delta = this->delta();
-  auto denominator = this->denominator();
-  for ( unsigned int r = 1; r < nr; ++r ) {
-
-    for ( unsigned int rp = 0; rp < r; ++rp ) {
-
-      term += 2. * elastic[r] * elastic[rp]
-                 * ( delta[r] * delta[rp]+ 0.25 * total[r] * total[rp] )
-              / denominator[r] / denominator[rp];
-    }
-  }
-
-  // calculate the resonance crossterm and add it to the elastic cross section
-  result[ this->elasticID() ] += factor * term;
+               std::map< ReactionID, CrossSection >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using MLBW
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a dense array containing the accumulated cross
+ *                          sections
+ */
+void evaluate( const Energy& energy, std::vector< double >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy using MLBW
+ *
+ *  The cross section values (in barn) and their derivatives (in barn/eV) are
+ *  accumulated in dense arrays using the reaction slots of the l,J pair (see
+ *  internReactions()). The derivatives are calculated analytically together
+ *  with the cross sections, which requires energy independent channel radii.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ *  @param[in,out] workspace    the spin group workspace
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative,
+               SpinGroupWorkspace& ) const {
+
+  const auto values = this->crossSectionDerivatives< true >( energy );
+  this->accumulate( values.first, result );
+  this->accumulate( values.second, derivative );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy using MLBW
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, derivative, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using MLBW, with
+ *         the resonance crossterm calculated as a double sum over all
+ *         resonance pairs
+ *
+ *  This reference calculation requires O(N^2) operations for N resonances
+ *  and is only intended for the validation of evaluate(), which calculates
+ *  the same crossterm in O(N) operations.
+ *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the accumulated cross sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluateReference( const Energy& energy,
+                        std::map< ReactionID, CrossSection >& result,
+                        SpinGroupWorkspace& workspace ) const {
+
+  // calculate the SLBW cross sections (storing the resonance values)
+  this->accumulate( this->crossSections< false, true >( energy, workspace ),
+                    result );
+
+  // add the resonance crossterm to the elastic cross section
+  result[ this->elasticID() ] += this->interference( energy, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using MLBW, with
+ *         the resonance crossterm calculated as a double sum over all
+ *         resonance pairs
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a map containing the accumulated cross sections
+ */
+void evaluateReference( const Energy& energy,
+                        std::map< ReactionID, CrossSection >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluateReference( energy, result, workspace );
 }
@@ -0,0 +1,45 @@
+/**
+ *  @brief Calculate the MLBW resonance interference term for the elastic
+ *         cross section at the given energy as a double sum over all
+ *         resonance pairs
+ *
+ *  This is the O(N^2) reference calculation of the interference term (see
+ *  evaluateReference()).
+ *
+ *  This function uses the resonance values stored in the workspace by the
+ *  SLBW cross section calculation at the same energy.
+ *
+ *  @param[in] energy      the incident energy
+ *  @param[in] workspace   the spin group workspace with the precomputed values
+ */
+CrossSection interference( const Energy& energy,
+                           const SpinGroupWorkspace& workspace ) const {
+
+  // data we need: k, P, phi, rho, g_J
+  const auto channel = this->incidentChannel();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto spinFactor = channel.statisticalSpinFactor();
+
+  // the pi / k2 factor
+  const CrossSection factor = pi / ( waveNumber * waveNumber ) * spinFactor;
+
+  // calculate the elastic cross term for MLBW
+  double term = 0.;
+  const unsigned int nr = this->resonanceTable().numberResonances();
+  const double* elastic = workspace.elastic.data();
+  const double* total = workspace.total.data();
+  const double* delta = workspace.delta.data();
+  const double* denominator = workspace.denominator.data();
+  for ( unsigned int r = 1; r < nr; ++r ) {
+
+    for ( unsigned int rp = 0; rp < r; ++rp ) {
+
+      term += 2. * elastic[r] * elastic[rp]
+                 * ( delta[r] * delta[rp]+ 0.25 * total[r] * total[rp] )
+              / denominator[r] / denominator[rp];
+    }
+  }
+
+  // the resonance crossterm for the elastic cross section
+  return factor * term;
+}
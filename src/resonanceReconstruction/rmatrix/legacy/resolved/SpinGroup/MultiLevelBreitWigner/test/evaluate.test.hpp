@@ -99,5 +99,28 @@ SCENARIO( "evaluate" ) {
       CHECK( 42264.081005233311 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "the resonance crossterm is identical to the reference double sum "
+          "over the resonance pairs" ) {
+
+      auto workspace = group.workspace();
+      for ( auto energy : { 1e-5 * electronVolt, 1e-1 * electronVolt,
+                            4.755 * electronVolt, 5. * electronVolt,
+                            5.245 * electronVolt, 1e+2 * electronVolt } ) {
+
+        std::map< ReactionID, CrossSection > xs;
+        std::map< ReactionID, CrossSection > reference;
+        group.evaluate( energy, xs, workspace );
+        group.evaluateReference( energy, reference, workspace );
+        CHECK( 2 == reference.size() );
+        CHECK( reference[ elas ].value == Approx( xs[ elas ].value ) );
+        CHECK( reference[ capt ].value == Approx( xs[ capt ].value ) );
+      }
+
+      std::map< ReactionID, CrossSection > xs;
+      group.evaluateReference( 5. * electronVolt, xs );
+      CHECK( 185934.6866480720 == Approx( xs[ elas ].value ) );
+      CHECK( 87782.287793509589 == Approx( xs[ capt ].value ) );
+    } // THEN
   } // GIVEN
 } // SCENARIO
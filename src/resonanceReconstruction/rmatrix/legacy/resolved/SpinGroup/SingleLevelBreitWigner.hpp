@@ -8,35 +8,21 @@
 template <>
 class SpinGroup< SingleLevelBreitWigner > : protected SpinGroupBase< resolved::ResonanceTable > {
 
-  /* aliases */
-  using EnergySquared = decltype( std::declval< Energy >() *
-                                  std::declval< Energy >() );
-
   /* fields */
   Energy qx_;
+  ResonanceConstants constants_;
 
-  std::vector< Width > elastic_;
-  std::vector< Width > capture_;
-  std::vector< Width > fission_;
-  std::vector< Width > total_;
-  std::vector< Energy > delta_;
-  std::vector< EnergySquared > denominator_;
+protected:
 
   /* auxiliary functions */
-  #include "resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/SingleLevelBreitWigner/src/precompute.hpp"
-
-protected:
+  #include "resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/SingleLevelBreitWigner/src/crossSections.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/resolved/SpinGroup/SingleLevelBreitWigner/src/crossSectionDerivatives.hpp"
 
   using SpinGroupBase::elasticID;
   using SpinGroupBase::captureID;
   using SpinGroupBase::fissionID;
-
-  auto elastic() const { return ranges::view::all( this->elastic_ ); }
-  auto capture() const { return ranges::view::all( this->capture_ ); }
-  auto fission() const { return ranges::view::all( this->fission_ ); }
-  auto total() const { return ranges::view::all( this->total_ ); }
-  auto delta() const { return ranges::view::all( this->delta_ ); }
-  auto denominator() const { return ranges::view::all( this->denominator_ ); }
+  using SpinGroupBase::elasticSlot;
+  using SpinGroupBase::accumulate;
 
 public:
 
@@ -49,6 +35,9 @@ public:
   using SpinGroupBase::orbitalAngularMomentum;
   using SpinGroupBase::totalAngularMomentum;
   using SpinGroupBase::resonanceTable;
+  using SpinGroupBase::hasFission;
+  using SpinGroupBase::internReactions;
+  using SpinGroupBase::workspace;
 
   /**
    *  @brief Return competitive Q value
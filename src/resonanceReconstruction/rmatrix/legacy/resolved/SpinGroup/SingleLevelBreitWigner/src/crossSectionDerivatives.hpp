@@ -0,0 +1,179 @@
+/**
+ *  @brief Calculate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy using SLBW
+ *
+ *  The derivatives are calculated analytically in the same loop over the
+ *  resonances as the cross sections (see crossSections()). For every
+ *  resonance, the energy dependence of the cross sections enters through the
+ *  resonance denominator D_r = ( E - Er' )^2 + Gt_r^2 / 4 (with Er' depending
+ *  on the shift factor and Gn_r and Gt_r on the penetrability) and through
+ *  the phase shift, so that only the derivatives of P, S and phi (see
+ *  channelDerivatives()) are required besides the resonance values that are
+ *  already calculated. The derivative of the MLBW resonance interference term
+ *  follows from the derivatives of the sums used in crossSections():
+ *
+ *    2 ( sum_r a_r ) ( sum_r a_r' ) - 2 sum_r a_r a_r'
+ *      + 2 ( sum_r b_r ) ( sum_r b_r' ) - 2 sum_r b_r b_r'
+ *
+ *  in which a_r' and b_r' are the derivatives of a_r and b_r.
+ *
+ *  @tparam Interference   whether or not to add the MLBW interference term
+ *  @param[in] energy      the incident energy
+ *
+ *  @return the cross sections and their derivatives (in barn/eV)
+ */
+template < bool Interference >
+std::pair< Data< CrossSection >, Data< double > >
+crossSectionDerivatives( const Energy& energy ) const {
+
+  // data we need: k, P, phi, rho, g_J and the derivatives of P, S and phi
+  const auto channel = this->incidentChannel();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto qx = this->QX();
+  const double p = channel.penetrability( energy );
+  const double q = qx.value != 0. ? channel.penetrability( energy - qx ) : p;
+  const double s = channel.shiftFactor( energy );
+  const auto phaseShift = channel.phaseShift( energy );
+  const auto spinFactor = channel.statisticalSpinFactor();
+  const double sinphi = std::sin( phaseShift );
+  const double sintwophi = std::sin( 2. * phaseShift );
+  const double costwophi = std::cos( 2. * phaseShift );
+  const double sin2phi = sinphi * sinphi;
+
+  const auto derivatives = this->channelDerivatives( energy );
+  const double dp = derivatives[0];
+  const double dq = qx.value != 0.
+                    ? this->channelDerivatives( energy - qx )[0] : dp;
+  const double ds = derivatives[1];
+  const double dphi = derivatives[2];
+  const double dsin2phi = sintwophi * dphi;
+  const double dsintwophi = 2. * costwophi * dphi;
+
+  // the pi / k2 factor and its derivative (k2 is proportional to E)
+  const CrossSection factor = pi / ( waveNumber * waveNumber ) * spinFactor;
+  const double dfactor = - factor.value / energy.value;
+
+  // the resonance constants
+  constexpr unsigned int lanes = ResonanceConstants::lanes;
+  const unsigned int size = this->constants_.paddedSize();
+  const double* er = this->constants_.energy();
+  const double* shift = this->constants_.shift();
+  const double* gn = this->constants_.elastic();
+  const double* gg = this->constants_.capture();
+  const double* gf = this->constants_.fission();
+  const double* gx = this->constants_.competition();
+
+  // accumulate the cross section components and their derivatives
+  const double e = energy.value;
+  double elastic[ lanes ] = {};
+  double capture[ lanes ] = {};
+  double fission[ lanes ] = {};
+  double delastic[ lanes ] = {};
+  double dcapture[ lanes ] = {};
+  double dfission[ lanes ] = {};
+  double a[ lanes ] = {};
+  double a2[ lanes ] = {};
+  double b[ lanes ] = {};
+  double b2[ lanes ] = {};
+  double da[ lanes ] = {};
+  double ada[ lanes ] = {};
+  double db[ lanes ] = {};
+  double bdb[ lanes ] = {};
+  for ( unsigned int block = 0; block < size; block += lanes ) {
+
+    for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+      const unsigned int r = block + lane;
+      const double width = p * gn[r];
+      const double dwidth = dp * gn[r];
+      const double total = width + gg[r] + gf[r] + q * gx[r];
+      const double dtotal = dwidth + dq * gx[r];
+      const double delta = e - er[r] + s * shift[r];
+      const double ddelta = 1. + ds * shift[r];
+      const double denominator = delta * delta + 0.25 * total * total;
+      const double ddenominator = 2. * delta * ddelta + 0.5 * total * dtotal;
+      const double ratio = width / denominator;
+      const double dratio = ( dwidth - ratio * ddenominator ) / denominator;
+      const double numerator = width - 2. * total * sin2phi
+                               + 2. * delta * sintwophi;
+      const double dnumerator = dwidth - 2. * dtotal * sin2phi
+                                - 2. * total * dsin2phi
+                                + 2. * ddelta * sintwophi
+                                + 2. * delta * dsintwophi;
+      elastic[ lane ] += numerator * ratio;
+      capture[ lane ] += gg[r] * ratio;
+      fission[ lane ] += gf[r] * ratio;
+      delastic[ lane ] += dnumerator * ratio + numerator * dratio;
+      dcapture[ lane ] += gg[r] * dratio;
+      dfission[ lane ] += gf[r] * dratio;
+
+      if constexpr ( Interference ) {
+
+        const double ar = delta * ratio;
+        const double br = 0.5 * total * ratio;
+        const double dar = ddelta * ratio + delta * dratio;
+        const double dbr = 0.5 * ( dtotal * ratio + total * dratio );
+        a[ lane ] += ar;
+        a2[ lane ] += ar * ar;
+        b[ lane ] += br;
+        b2[ lane ] += br * br;
+        da[ lane ] += dar;
+        ada[ lane ] += ar * dar;
+        db[ lane ] += dbr;
+        bdb[ lane ] += br * dbr;
+      }
+    }
+  }
+
+  // reduce the partial sums in a fixed order
+  Data< double > components{ 0., 0., 0., 0. };
+  Data< double > dcomponents{ 0., 0., 0., 0. };
+  for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+    components.elastic += elastic[ lane ];
+    components.capture += capture[ lane ];
+    components.fission += fission[ lane ];
+    dcomponents.elastic += delastic[ lane ];
+    dcomponents.capture += dcapture[ lane ];
+    dcomponents.fission += dfission[ lane ];
+  }
+
+  if constexpr ( Interference ) {
+
+    double suma = 0.;
+    double suma2 = 0.;
+    double sumb = 0.;
+    double sumb2 = 0.;
+    double sumda = 0.;
+    double sumada = 0.;
+    double sumdb = 0.;
+    double sumbdb = 0.;
+    for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+      suma += a[ lane ];
+      suma2 += a2[ lane ];
+      sumb += b[ lane ];
+      sumb2 += b2[ lane ];
+      sumda += da[ lane ];
+      sumada += ada[ lane ];
+      sumdb += db[ lane ];
+      sumbdb += bdb[ lane ];
+    }
+    components.elastic += ( suma * suma - suma2 ) + ( sumb * sumb - sumb2 );
+    dcomponents.elastic += 2. * ( suma * sumda - sumada )
+                           + 2. * ( sumb * sumdb - sumbdb );
+  }
+
+  // calculate the resulting cross sections and derivatives
+  return { { factor * components.elastic,
+             factor * components.capture,
+             factor * components.fission,
+             0. * barns },
+           { dfactor * components.elastic
+               + factor.value * dcomponents.elastic,
+             dfactor * components.capture
+               + factor.value * dcomponents.capture,
+             dfactor * components.fission
+               + factor.value * dcomponents.fission,
+             0. } };
+}
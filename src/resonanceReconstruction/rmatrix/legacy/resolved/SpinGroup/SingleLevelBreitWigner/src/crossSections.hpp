@@ -0,0 +1,142 @@
+/**
+ *  @brief Calculate the cross sections at the given energy using SLBW
+ *
+ *  The sums over the resonances are calculated using the resonance constants
+ *  in blocks of ResonanceConstants::lanes resonances, with a separate partial
+ *  sum for each lane. The lanes are independent so that the compiler can
+ *  vectorise the loop without changing the order of the floating point
+ *  operations, and the partial sums are added in a fixed order afterwards.
+ *
+ *  When requested, the MLBW resonance interference term is added to the
+ *  elastic cross section. This term is a sum over all resonance pairs:
+ *
+ *    sum_{r != r'} ( a_r a_r' + b_r b_r' )
+ *      = ( sum_r a_r )^2 - sum_r a_r^2 + ( sum_r b_r )^2 - sum_r b_r^2
+ *
+ *  with a_r = Gn_r ( E - Er' ) / D_r and b_r = Gn_r Gt_r / ( 2 D_r ) (D_r
+ *  being the resonance denominator), so that it can be calculated in the same
+ *  loop as the SLBW cross sections, i.e. in O(N) operations instead of O(N^2).
+ *
+ *  When requested, the energy dependent values for each resonance (the
+ *  elastic and total width, the distance to the primed resonance energy and
+ *  the resonance denominator) are stored in the workspace for the reference
+ *  calculation of the MLBW interference term.
+ *
+ *  @tparam Interference       whether or not to add the MLBW interference term
+ *  @tparam Store              whether or not to store the resonance values
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] workspace   the spin group workspace
+ */
+template < bool Interference, bool Store >
+Data< CrossSection > crossSections( const Energy& energy,
+                                    SpinGroupWorkspace& workspace ) const {
+
+  // data we need: k, P, phi, rho, g_J
+  const auto channel = this->incidentChannel();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto qx = this->QX();
+  const double p = channel.penetrability( energy );
+  const double q = qx.value != 0. ? channel.penetrability( energy - qx ) : p;
+  const double s = channel.shiftFactor( energy );
+  const auto phaseShift = channel.phaseShift( energy );
+  const auto spinFactor = channel.statisticalSpinFactor();
+  const double sinphi = std::sin( phaseShift );
+  const double sintwophi = std::sin( 2. * phaseShift );
+  const double sin2phi = sinphi * sinphi;
+
+  // the pi / k2 factor
+  const CrossSection factor = pi / ( waveNumber * waveNumber ) * spinFactor;
+
+  // the resonance constants
+  constexpr unsigned int lanes = ResonanceConstants::lanes;
+  const unsigned int size = this->constants_.paddedSize();
+  const double* er = this->constants_.energy();
+  const double* shift = this->constants_.shift();
+  const double* gn = this->constants_.elastic();
+  const double* gg = this->constants_.capture();
+  const double* gf = this->constants_.fission();
+  const double* gx = this->constants_.competition();
+
+  if constexpr ( Store ) {
+
+    workspace.elastic.resize( size );
+    workspace.total.resize( size );
+    workspace.delta.resize( size );
+    workspace.denominator.resize( size );
+  }
+
+  // accumulate the cross section components
+  const double e = energy.value;
+  double elastic[ lanes ] = {};
+  double capture[ lanes ] = {};
+  double fission[ lanes ] = {};
+  double a[ lanes ] = {};
+  double a2[ lanes ] = {};
+  double b[ lanes ] = {};
+  double b2[ lanes ] = {};
+  for ( unsigned int block = 0; block < size; block += lanes ) {
+
+    for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+      const unsigned int r = block + lane;
+      const double width = p * gn[r];
+      const double total = width + gg[r] + gf[r] + q * gx[r];
+      const double delta = e - er[r] + s * shift[r];
+      const double denominator = delta * delta + 0.25 * total * total;
+      const double ratio = width / denominator;
+      elastic[ lane ] += ( width - 2. * total * sin2phi
+                           + 2. * delta * sintwophi ) * ratio;
+      capture[ lane ] += gg[r] * ratio;
+      fission[ lane ] += gf[r] * ratio;
+
+      if constexpr ( Interference ) {
+
+        const double ar = delta * ratio;
+        const double br = 0.5 * total * ratio;
+        a[ lane ] += ar;
+        a2[ lane ] += ar * ar;
+        b[ lane ] += br;
+        b2[ lane ] += br * br;
+      }
+
+      if constexpr ( Store ) {
+
+        workspace.elastic[r] = width;
+        workspace.total[r] = total;
+        workspace.delta[r] = delta;
+        workspace.denominator[r] = denominator;
+      }
+    }
+  }
+
+  // reduce the partial sums in a fixed order
+  Data< double > components{ 0., 0., 0., 0. };
+  for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+    components.elastic += elastic[ lane ];
+    components.capture += capture[ lane ];
+    components.fission += fission[ lane ];
+  }
+
+  if constexpr ( Interference ) {
+
+    double suma = 0.;
+    double suma2 = 0.;
+    double sumb = 0.;
+    double sumb2 = 0.;
+    for ( unsigned int lane = 0; lane < lanes; ++lane ) {
+
+      suma += a[ lane ];
+      suma2 += a2[ lane ];
+      sumb += b[ lane ];
+      sumb2 += b2[ lane ];
+    }
+    components.elastic += ( suma * suma - suma2 ) + ( sumb * sumb - sumb2 );
+  }
+
+  // calculate the resulting cross sections
+  return { factor * components.elastic,
+           factor * components.capture,
+           factor * components.fission,
+           0. * barns };
+}
@@ -8,9 +8,4 @@
 SpinGroup( Channel< Neutron >&& incident, resolved::ResonanceTable&& table,
            const Energy& qx ) :
   SpinGroupBase( std::move( incident ), std::move( table ) ),
-  qx_( qx ),
-  elastic_( table.resonances().size() ),
-  capture_( table.resonances().size() ),
-  fission_( table.resonances().size() ),
-  total_( table.resonances().size() ),
-  delta_( table.resonances().size() ) {}
+  qx_( qx ), constants_( this->resonanceTable() ) {}
@@ -1,57 +1,106 @@
 /**
  *  @brief Evaluate the cross sections at the given energy using SLBW
  *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a map containing the accumulated cross sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluate( const Energy& energy,
+               std::map< ReactionID, CrossSection >& result,
+               SpinGroupWorkspace& workspace ) const {
+
+  this->accumulate( this->crossSections< false, false >( energy, workspace ),
+                    result );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using SLBW
+ *
+ *  The cross section values (in barn) are accumulated in a dense array using
+ *  the reaction slots of the l,J pair (see internReactions()).
+ *
+ *  @param[in] energy          the incident energy
+ *  @param[in,out] result      a dense array containing the accumulated cross
+ *                             sections
+ *  @param[in,out] workspace   the spin group workspace
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               SpinGroupWorkspace& workspace ) const {
+
+  this->accumulate( this->crossSections< false, false >( energy, workspace ),
+                    result );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using SLBW
+ *
+ *  This function uses a temporary workspace.
+ *
  *  @param[in] energy       the incident energy
  *  @param[in,out] result   a map containing the accumulated cross sections
  */
 void evaluate( const Energy& energy,
-               std::map< ReactionID, CrossSection >& result ) {
-
-  // data we need: k, P, phi, rho, g_J
-  const auto channel = this->incidentChannel();
-  const auto waveNumber = channel.waveNumber( energy );
-  const auto qx = this->QX();
-  const auto p = channel.penetrability( energy );
-  const auto q = qx.value != 0. ? channel.penetrability( energy - qx ) : p;
-  const auto s = channel.shiftFactor( energy );
-  const auto phaseShift = channel.phaseShift( energy );
-  const auto spinFactor = channel.statisticalSpinFactor();
-  const auto sinphi = std::sin( phaseShift );
-  const auto sintwophi = std::sin( 2. * phaseShift );
-  const auto sin2phi = sinphi * sinphi;
-
-  // the pi / k2 factor
-  const CrossSection factor = pi / ( waveNumber * waveNumber ) * spinFactor;
-
-  // precompute values for SLBW and MLBW
-  this->precompute( energy );
-
-  // lambda to calculate the cross sections for each resonance
-  auto calculate = [&] ( const auto& elastic, const auto& capture,
-                         const auto& fission, const auto& total,
-                         const auto& delta, const auto& denominator )
-                       -> Data< double > {
-
-    return { ( elastic * ( elastic - 2. * total * sin2phi
-                           + 2. * delta * sintwophi ) ) / denominator,
-             capture * elastic / denominator,
-             fission * elastic / denominator,
-             0.0 };
-  };
-
-  // accumulate the cross section components
-  const Data< double > components =
-    ranges::accumulate( ranges::view::zip_with(
-                            calculate,
-                            this->elastic(), this->capture(), this->fission(),
-                            this->total(), this->delta(), this->denominator() ),
-                        Data< double >{ 0., 0., 0., 0. } );
-
-  // calculate the resulting cross sections
-  result[ this->elasticID() ] += factor * components.elastic;
-  result[ this->captureID() ] += factor * components.capture;
-  if ( components.hasFission() ) {
-
-    result[ this->fissionID() ] += factor * components.fission;
-  }
+               std::map< ReactionID, CrossSection >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy using SLBW
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a dense array containing the accumulated cross
+ *                          sections
+ */
+void evaluate( const Energy& energy, std::vector< double >& result ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, workspace );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy using SLBW
+ *
+ *  The cross section values (in barn) and their derivatives (in barn/eV) are
+ *  accumulated in dense arrays using the reaction slots of the l,J pair (see
+ *  internReactions()). The derivatives are calculated analytically together
+ *  with the cross sections, which requires energy independent channel radii.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ *  @param[in,out] workspace    the spin group workspace
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative,
+               SpinGroupWorkspace& ) const {
+
+  const auto values = this->crossSectionDerivatives< false >( energy );
+  this->accumulate( values.first, result );
+  this->accumulate( values.second, derivative );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy using SLBW
+ *
+ *  This function uses a temporary workspace.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative ) const {
+
+  auto workspace = this->workspace();
+  this->evaluate( energy, result, derivative, workspace );
 }
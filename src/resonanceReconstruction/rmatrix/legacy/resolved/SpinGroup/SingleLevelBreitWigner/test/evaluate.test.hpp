@@ -99,5 +99,30 @@ SCENARIO( "evaluate" ) {
       CHECK( 42264.081005233311 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "cross section derivatives can be calculated for l=0" ) {
+
+      for ( double energy : { 1e-2, 1., 4.755, 5., 5.245, 1e+2 } ) {
+
+        std::vector< double > xs( 3, 0. );
+        std::vector< double > values( 3, 0. );
+        std::vector< double > derivatives( 3, 0. );
+        group.evaluate( energy * electronVolt, xs );
+        group.evaluate( energy * electronVolt, values, derivatives );
+        CHECK( xs[0] == Approx( values[0] ) );
+        CHECK( xs[1] == Approx( values[1] ) );
+
+        // compare with a central finite difference
+        const double h = 1e-6 * energy;
+        std::vector< double > upper( 3, 0. );
+        std::vector< double > lower( 3, 0. );
+        group.evaluate( ( energy + h ) * electronVolt, upper );
+        group.evaluate( ( energy - h ) * electronVolt, lower );
+        CHECK( ( upper[0] - lower[0] ) / ( 2. * h ) ==
+               Approx( derivatives[0] ).epsilon( 1e-5 ) );
+        CHECK( ( upper[1] - lower[1] ) / ( 2. * h ) ==
+               Approx( derivatives[1] ).epsilon( 1e-5 ) );
+      }
+    } // THEN
   } // GIVEN
 } // SCENARIO
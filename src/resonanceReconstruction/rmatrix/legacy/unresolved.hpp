@@ -9,8 +9,9 @@ namespace unresolved {
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/Resonance.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable.hpp"
 
-  // function to calculate the fluctuation integrals
+  // functions to calculate the fluctuation integrals and their derivatives
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/src/calculateFluctuationIntegrals.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/unresolved/src/calculateFluctuationIntegralDerivatives.hpp"
 
   // unresolved spin group and compound system
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/SpinGroup.hpp"
@@ -16,6 +16,9 @@ public:
 
   /* methods */
   using CompoundSystemBase::spinGroups;
+  using CompoundSystemBase::reactionIndex;
+  using CompoundSystemBase::workspace;
+  using CompoundSystemBase::hasDerivatives;
   using CompoundSystemBase::evaluate;
 
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/CompoundSystem/src/grid.hpp"
@@ -3,34 +3,32 @@
  *  @brief Unresolved resonance parameters for a specific l,J value
  *
  *  Since it is required to interpolate on the resonance parameters, this
- *  class also stores interpolation tables to provide unresolved resonances
+ *  class also stores an interpolation table to provide unresolved resonances
  *  at any energy in the unresolved resonance region.
  *
- *  @todo since C++17 does not allow us to decltype() something using lambdas,
- *        a ranges::view::transformed table cannot be created and stored as
- *        a member of the class. It could be done in the call function but then
- *        the interpolation table would be created every time.
+ *  The level spacing and the widths share the same energy nodes so they are
+ *  stored in a single fused table: a single interval search is required for
+ *  each energy after which all parameters are interpolated from the same
+ *  contiguous row. The interval found last on a given thread is kept as a
+ *  cursor and is tried first (along with the next one) when looking up the
+ *  next energy, so that a sweep over sorted energies does not require any
+ *  search at all. Since the cursor is validated against the energy nodes of
+ *  the table being used, it is shared by all l,J tables that have the same
+ *  energy nodes (as ENDF normally requires).
  *
  *  @todo we currently only assume linear interpolation on the parameters
  */
 class ResonanceTable : protected ResonanceTableBase< Resonance > {
 
-  /* aliases */
-  using LevelSpacingTable = LinLinTable< Energy, LevelSpacing >;
-  using ReducedWidthTable = LinLinTable< Energy, ReducedWidth >;
-  using WidthTable = LinLinTable< Energy, Width >;
-
   /* fields */
   Degrees degrees_;
-  LevelSpacingTable level_spacing_table_;
-  ReducedWidthTable elastic_table_;
-  WidthTable capture_table_;
-  WidthTable fission_table_;
-  WidthTable competition_table_;
+  std::vector< double > energies_;
+  std::vector< std::array< double, 5 > > parameters_;
 
   /* auxiliary functions */
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable/src/verifyTable.hpp"
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable/src/make.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable/src/interval.hpp"
 
 public:
 
@@ -46,6 +44,7 @@ public:
   const Degrees& degreesOfFreedom() const { return this->degrees_; }
 
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable/src/call.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable/src/derivatives.hpp"
 
   /* constructor */
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/ResonanceTable/src/ctor.hpp"
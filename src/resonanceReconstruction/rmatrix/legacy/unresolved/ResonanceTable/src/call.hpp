@@ -3,12 +3,25 @@
  *
  *  @param[in] energy       the incident energy
  */
-auto operator()( const Energy& energy ) const {
+Resonance operator()( const Energy& energy ) const {
+
+  const std::size_t i = this->interval( energy.value );
+  const double x0 = this->energies_[i];
+  const double x1 = this->energies_[i + 1];
+  const auto& y0 = this->parameters_[i];
+  const auto& y1 = this->parameters_[i + 1];
+
+  const double fraction = x1 > x0 ? ( energy.value - x0 ) / ( x1 - x0 ) : 0.;
+  std::array< double, 5 > values;
+  for ( unsigned int q = 0; q < 5; ++q ) {
+
+    values[q] = y0[q] + fraction * ( y1[q] - y0[q] );
+  }
 
   return Resonance( energy,
-                    this->level_spacing_table_( energy ),
-                    this->elastic_table_( energy ),
-                    this->capture_table_( energy ),
-                    this->fission_table_( energy ),
-                    this->competition_table_( energy ) );
+                    values[0] * electronVolt,
+                    values[1] * rootElectronVolt,
+                    values[2] * electronVolt,
+                    values[3] * electronVolt,
+                    values[4] * electronVolt );
 }
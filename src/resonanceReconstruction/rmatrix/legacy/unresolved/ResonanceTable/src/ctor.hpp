@@ -1,25 +1,3 @@
-private:
-
-/**
- *  @brief Private intermediate constructor
- */
-ResonanceTable( std::vector< Resonance >&& resonances,
-                Degrees&& degrees,
-                std::tuple< LevelSpacingTable, ReducedWidthTable,
-                            WidthTable, WidthTable, WidthTable >&& tables ) :
-    ResonanceTableBase( std::move( resonances ) ),
-    degrees_( std::move( degrees ) ),
-    level_spacing_table_( std::move( std::get< 0 >( tables ) ) ),
-    elastic_table_( std::move( std::get< 1 >( tables ) ) ),
-    capture_table_( std::move( std::get< 2 >( tables ) ) ),
-    fission_table_( std::move( std::get< 3 >( tables ) ) ),
-    competition_table_( std::move( std::get< 4 >( tables ) ) ) {
-
-    verifyTable( this->resonances(), this->degrees_ );
-}
-
-public:
-
 /**
  *  @brief Constructor
  *
@@ -29,6 +7,10 @@ public:
  */
 ResonanceTable( std::vector< Resonance >&& resonances,
                 Degrees&& degrees ) :
-    ResonanceTable( std::move( resonances ),
-                    std::move( degrees ),
-                    makeTables( resonances ) ) {}
+    ResonanceTableBase( std::move( resonances ) ),
+    degrees_( std::move( degrees ) ) {
+
+    verifyTable( this->resonances(), this->degrees_ );
+    this->energies_ = makeEnergies( this->resonances() );
+    this->parameters_ = makeParameters( this->resonances() );
+}
@@ -0,0 +1,31 @@
+/**
+ *  @brief Return the derivatives of the unresolved resonance parameters with
+ *         respect to the energy at the given energy
+ *
+ *  Since the parameters are interpolated linearly, the derivatives are
+ *  constant over each interval of the table. At an energy node, the interval
+ *  on the left is used (consistent with operator()).
+ *
+ *  @param[in] energy       the incident energy
+ *
+ *  @return the derivatives of the level spacing and the elastic reduced,
+ *          capture, fission and competition widths (in eV/eV or sqrt(eV)/eV)
+ */
+std::array< double, 5 > derivatives( const Energy& energy ) const {
+
+  const std::size_t i = this->interval( energy.value );
+  const double x0 = this->energies_[i];
+  const double x1 = this->energies_[i + 1];
+  const auto& y0 = this->parameters_[i];
+  const auto& y1 = this->parameters_[i + 1];
+
+  std::array< double, 5 > values{};
+  if ( x1 > x0 ) {
+
+    for ( unsigned int q = 0; q < 5; ++q ) {
+
+      values[q] = ( y1[q] - y0[q] ) / ( x1 - x0 );
+    }
+  }
+  return values;
+}
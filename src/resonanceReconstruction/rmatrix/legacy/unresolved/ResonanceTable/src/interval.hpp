@@ -0,0 +1,45 @@
+/**
+ *  @brief Return the index of the interval containing the given energy
+ *
+ *  The interval i is defined as energies[i] < energy <= energies[i+1] (the
+ *  first interval also includes the first energy), so that the value on the
+ *  left is used at a discontinuity. The cursor from the previous lookup on
+ *  this thread and the interval following it are tried before reverting to a
+ *  binary search.
+ *
+ *  @param[in] energy   the energy (in eV)
+ */
+std::size_t interval( double energy ) const {
+
+  thread_local std::size_t cursor = 0;
+
+  const auto& x = this->energies_;
+  const std::size_t last = x.size() - 1;
+  if ( ( energy < x.front() ) or ( energy > x.back() ) ) {
+
+    Log::error( "The energy is outside of the unresolved resonance table" );
+    Log::info( "Energy: {} eV", energy );
+    Log::info( "Table energy range: [{}, {}] eV", x.front(), x.back() );
+    throw std::exception();
+  }
+
+  auto inside = [&] ( std::size_t i ) {
+
+    return ( i < last ) and ( energy <= x[i + 1] ) and
+           ( ( x[i] < energy ) or ( ( i == 0 ) and ( x[i] == energy ) ) );
+  };
+
+  if ( not inside( cursor ) ) {
+
+    if ( inside( cursor + 1 ) ) {
+
+      ++cursor;
+    }
+    else {
+
+      const auto upper = std::lower_bound( x.begin() + 1, x.end(), energy );
+      cursor = std::distance( x.begin(), upper ) - 1;
+    }
+  }
+  return cursor;
+}
@@ -10,6 +10,19 @@ void verifyTable( const std::vector< Resonance >& resonances,
     throw std::exception();
   }
 
+  const auto unsorted =
+    std::adjacent_find( resonances.begin(), resonances.end(),
+                        [] ( const auto& left, const auto& right )
+                           { return left.energy() > right.energy(); } );
+  if ( unsorted != resonances.end() ) {
+
+    Log::error( "The energies in an unresolved resonance table must be "
+                "sorted in ascending order" );
+    Log::info( "Found {} eV followed by {} eV", unsorted->energy().value,
+               std::next( unsorted )->energy().value );
+    throw std::exception();
+  }
+
   const auto verifyDegreesOfFreedom = [] ( const auto& entry ) {
 
     if ( entry > 4 ) {
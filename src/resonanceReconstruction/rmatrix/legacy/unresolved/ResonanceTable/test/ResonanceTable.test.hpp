@@ -110,5 +110,12 @@ SCENARIO( "ResonanceTable" ) {
                                    20. * electronVolt,
                                    5. * electronVolt ) }, { 1, 0, 1, 1 } ) );
     } // THEN
+
+    THEN( "an exception is thrown at construction when the energies are not "
+          "sorted" ) {
+
+      std::swap( resonances[0], resonances[1] );
+      CHECK_THROWS( ResonanceTable( std::move( resonances ), { 1, 0, 1, 1 } ) );
+    } // THEN
   } // GIVEN
 } // SCENARIO
@@ -117,6 +117,33 @@ SCENARIO( "call operator" ) {
       CHECK( 600. == Approx( resonance.fission().value ) );
       CHECK( 300. == Approx( resonance.competition().value ) );
     } // THEN
+
+    THEN( "the derivatives of the parameters can be retrieved at any energy" ) {
+
+      auto derivatives = table.derivatives( 1000. * electronVolt );
+
+      CHECK( 0. == derivatives[0] );
+      CHECK( 0. == derivatives[1] );
+      CHECK( 0. == derivatives[2] );
+      CHECK( 0.125 == Approx( derivatives[3] ) );
+      CHECK( 0. == derivatives[4] );
+
+      derivatives = table.derivatives( 5000. * electronVolt );
+
+      CHECK( 0. == derivatives[0] );
+      CHECK( 0. == derivatives[1] );
+      CHECK( 0. == derivatives[2] );
+      CHECK( 0.125 == Approx( derivatives[3] ) );
+      CHECK( 0. == derivatives[4] );
+
+      derivatives = table.derivatives( 6500. * electronVolt );
+
+      CHECK( 0. == derivatives[0] );
+      CHECK( 0. == derivatives[1] );
+      CHECK( 0. == derivatives[2] );
+      CHECK( -400. / 3000. == Approx( derivatives[3] ) );
+      CHECK( 0. == derivatives[4] );
+    } // THEN
   } // GIVEN
 
   GIVEN( "a valid ResonanceTable with full energy dependence" ) {
@@ -188,6 +215,58 @@ SCENARIO( "call operator" ) {
       CHECK( 500. == Approx( resonance.fission().value ) );
       CHECK( 1000. == Approx( resonance.competition().value ) );
     } // THEN
+
+    THEN( "the same values are retrieved regardless of the energy order" ) {
+
+      ResonanceTable other( { { 1000. * electronVolt,
+                                250. * electronVolt,
+                                100. * rootElectronVolt,
+                                500. * electronVolt,
+                                400. * electronVolt,
+                                200. * electronVolt },
+                              { 2000. * electronVolt,
+                                250. * electronVolt,
+                                100. * rootElectronVolt,
+                                500. * electronVolt,
+                                400. * electronVolt,
+                                200. * electronVolt },
+                              { 8000. * electronVolt,
+                                250. * electronVolt,
+                                100. * rootElectronVolt,
+                                500. * electronVolt,
+                                400. * electronVolt,
+                                200. * electronVolt } },
+                            { 2, 0, 4, 1 } );
+
+      std::vector< Energy > energies = { 1000. * electronVolt,
+                                         3000. * electronVolt,
+                                         5000. * electronVolt,
+                                         6500. * electronVolt,
+                                         8000. * electronVolt };
+      std::vector< double > ascending;
+      for ( const auto& energy : energies ) {
+
+        ascending.push_back( table( energy ).elastic().value );
+        CHECK( 100. == Approx( other( energy ).elastic().value ) );
+      }
+
+      std::vector< double > descending;
+      for ( auto energy = energies.rbegin(); energy != energies.rend(); ++energy ) {
+
+        descending.push_back( table( *energy ).elastic().value );
+        CHECK( 100. == Approx( other( *energy ).elastic().value ) );
+      }
+
+      CHECK( 800. == Approx( ascending[0] ) );
+      CHECK( 450. == Approx( ascending[1] ) );
+      CHECK( 100. == Approx( ascending[2] ) );
+      CHECK( 150. == Approx( ascending[3] ) );
+      CHECK( 200. == Approx( ascending[4] ) );
+      for ( unsigned int i = 0; i < energies.size(); ++i ) {
+
+        CHECK( ascending[i] == descending[ energies.size() - 1 - i ] );
+      }
+    } // THEN
   } // GIVEN
 
   GIVEN( "a valid ResonanceTable" ) {
@@ -7,6 +7,10 @@
  */
 class SpinGroup : protected SpinGroupBase< unresolved::ResonanceTable > {
 
+  /* auxiliary functions */
+  #include "resonanceReconstruction/rmatrix/legacy/unresolved/SpinGroup/src/crossSections.hpp"
+  #include "resonanceReconstruction/rmatrix/legacy/unresolved/SpinGroup/src/crossSectionDerivatives.hpp"
+
 public:
 
   /* constructor */
@@ -19,6 +23,9 @@ public:
   using SpinGroupBase::orbitalAngularMomentum;
   using SpinGroupBase::totalAngularMomentum;
   using SpinGroupBase::resonanceTable;
+  using SpinGroupBase::workspace;
+  using SpinGroupBase::hasFission;
+  using SpinGroupBase::internReactions;
 
   #include "resonanceReconstruction/rmatrix/legacy/unresolved/SpinGroup/src/evaluate.hpp"
 };
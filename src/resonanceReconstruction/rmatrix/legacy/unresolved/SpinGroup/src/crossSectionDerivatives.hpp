@@ -0,0 +1,104 @@
+/**
+ *  @brief Calculate the average cross sections and their derivatives with
+ *         respect to the incident energy at the given energy
+ *
+ *  The energy dependence of the average cross sections enters through the
+ *  2 pi^2 / k^2 factor, the phase shift, the elastic width (through the
+ *  penetrability) and the linearly interpolated level spacing and widths.
+ *  The derivatives of the fluctuation integrals are obtained by deriving the
+ *  quadrature with respect to the widths (see
+ *  calculateFluctuationIntegralDerivatives()).
+ *
+ *  Since the parameters are interpolated linearly, the derivatives are
+ *  discontinuous at the energies of the resonance table (the interval on
+ *  the left is used at these energies).
+ *
+ *  @param[in] energy   the incident energy
+ *
+ *  @return the cross sections and their derivatives (in barn/eV)
+ */
+std::pair< Data< CrossSection >, Data< double > >
+crossSectionDerivatives( const Energy& energy ) const {
+
+  // data we need: k, P, phi, rho, g_J and the derivatives of P and phi
+  const auto channel = this->incidentChannel();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto penetrability = channel.penetrability( energy );
+  const auto phaseShift = channel.phaseShift( energy );
+  const auto radius = channel.radii().penetrabilityRadius( energy );
+  const auto spinFactor = channel.statisticalSpinFactor();
+  const double ratio = waveNumber * radius;
+  const auto sinphi = std::sin( phaseShift );
+  const auto sin2phi = sinphi * sinphi;
+  const auto derivatives = this->channelDerivatives( energy );
+  const double dsin2phi = std::sin( 2. * phaseShift ) * derivatives[2];
+
+  // the 2 * pi2 / k2 factor (k2 is proportional to E)
+  const CrossSection factor = 2. * pi * pi / ( waveNumber * waveNumber );
+
+  // interpolate on the resonance parameters at this energy and get the level
+  // spacing and widths, as well as their derivatives
+  const auto parameters = this->resonanceTable()( energy );
+  const auto slopes = this->resonanceTable().derivatives( energy );
+  const auto spacing = parameters.levelSpacing();
+  const Degrees degrees = this->resonanceTable().degreesOfFreedom();
+  const double vl = degrees.elastic * penetrability / ratio; // ENDF D.98
+  const double root = std::sqrt( energy.value );
+  const Widths widths{ parameters.elastic() * sqrt( energy ) * vl ,
+                       parameters.capture(),
+                       parameters.fission(),
+                       parameters.competition() };
+
+  // sqrt(E) / rho is energy independent
+  const Data< double > dwidths{
+      slopes[1] * root * vl
+        + parameters.elastic().value * degrees.elastic * root / ratio
+          * derivatives[0],
+      slopes[2], slopes[3], slopes[4] };
+
+  // calculate the fluctuation integrals and their derivatives
+  const FluctuationIntegrals integrals =
+    calculateFluctuationIntegrals( widths, degrees );
+  const Data< double > dintegrals =
+    calculateFluctuationIntegralDerivatives( widths, dwidths, degrees );
+
+  // the 2 * pi2 / k2 * gJ / D factor and its derivative
+  const double spin = spinFactor / spacing.value;
+  const double common = factor.value * spin;
+  const double dcommon = - common * ( 1. / energy.value
+                                      + slopes[0] / spacing.value );
+
+  // the elastic, capture and fission terms and their derivatives
+  const double gn = widths.elastic.value;
+  const double gg = widths.capture.value;
+  const double gf = widths.fission.value;
+  const double elastic = gn * ( gn * integrals.elastic.value - 2. * sin2phi );
+  const double delastic =
+      dwidths.elastic * ( gn * integrals.elastic.value - 2. * sin2phi )
+      + gn * ( dwidths.elastic * integrals.elastic.value
+               + gn * dintegrals.elastic - 2. * dsin2phi );
+  const double capture = gn * gg * integrals.capture.value;
+  const double dcapture =
+      ( dwidths.elastic * gg + gn * dwidths.capture )
+        * integrals.capture.value
+      + gn * gg * dintegrals.capture;
+
+  // calculate the resulting cross sections and derivatives
+  std::pair< Data< CrossSection >, Data< double > > result(
+    { factor * ( spin * elastic ), common * capture * barns,
+      0. * barns, 0. * barns },
+    { dcommon * elastic + common * delastic,
+      dcommon * capture + common * dcapture,
+      0., 0. } );
+  if ( widths.hasFission() ) {
+
+    const double fission = gn * gf * integrals.fission.value;
+    const double dfission =
+        ( dwidths.elastic * gf + gn * dwidths.fission )
+          * integrals.fission.value
+        + gn * gf * dintegrals.fission;
+    result.first.fission = common * fission * barns;
+    result.second.fission = dcommon * fission + common * dfission;
+  }
+  return result;
+}
@@ -0,0 +1,53 @@
+/**
+ *  @brief Calculate the average cross sections at the given energy
+ *
+ *  @param[in] energy   the incident energy
+ */
+Data< CrossSection > crossSections( const Energy& energy ) const {
+
+  // data we need: k, P, phi, rho, g_J
+  const auto channel = this->incidentChannel();
+  const auto incident = channel.particlePair().particle().particleID();
+  const auto target = channel.particlePair().residual().particleID();
+  const auto waveNumber = channel.waveNumber( energy );
+  const auto penetrability = channel.penetrability( energy );
+  const auto phaseShift = channel.phaseShift( energy );
+  const auto radius = channel.radii().penetrabilityRadius( energy );
+  const auto spinFactor = channel.statisticalSpinFactor();
+  const auto ratio = waveNumber * radius;
+  const auto sinphi = std::sin( phaseShift );
+  const auto sin2phi = sinphi * sinphi;
+
+  // the 2 * pi2 / k2 factor
+  const CrossSection factor = 2. * pi * pi / ( waveNumber * waveNumber );
+
+  // interpolate on the resonance parameters at this energy and get the level
+  // spacing and widths
+  const auto parameters = this->resonanceTable()( energy );
+  const auto spacing = parameters.levelSpacing();
+  const Degrees degrees = this->resonanceTable().degreesOfFreedom();
+  const double vl = degrees.elastic * penetrability / ratio; // ENDF D.98
+  const Widths widths{ parameters.elastic() * sqrt( energy ) * vl ,
+                       parameters.capture(),
+                       parameters.fission(),
+                       parameters.competition() };
+
+  // calculate the fluctuation integrals
+  const FluctuationIntegrals integrals =
+    calculateFluctuationIntegrals( widths, degrees );
+
+  // calculate the resulting cross sections
+  Data< CrossSection > result(
+    factor * ( spinFactor / spacing *
+    ( widths.elastic * ( widths.elastic * integrals.elastic - 2. * sin2phi ) ) ),
+    factor * spinFactor / spacing *
+    ( widths.elastic * widths.capture * integrals.capture ),
+    0. * barns, 0. * barns );
+  if ( widths.hasFission() ) {
+
+    result.fission =
+      factor * spinFactor / spacing *
+      ( widths.elastic * widths.fission * integrals.fission );
+  }
+  return result;
+}
@@ -5,50 +5,82 @@
  *  @param[in,out] result   a map containing the accumulated cross sections
  */
 void evaluate( const Energy& energy,
-               std::map< ReactionID, CrossSection >& result ) {
-
-  // data we need: k, P, phi, rho, g_J
-  const auto channel = this->incidentChannel();
-  const auto incident = channel.particlePair().particle().particleID();
-  const auto target = channel.particlePair().residual().particleID();
-  const auto waveNumber = channel.waveNumber( energy );
-  const auto penetrability = channel.penetrability( energy );
-  const auto phaseShift = channel.phaseShift( energy );
-  const auto radius = channel.radii().penetrabilityRadius( energy );
-  const auto spinFactor = channel.statisticalSpinFactor();
-  const auto ratio = waveNumber * radius;
-  const auto sinphi = std::sin( phaseShift );
-  const auto sin2phi = sinphi * sinphi;
-
-  // the 2 * pi2 / k2 factor
-  const CrossSection factor = 2. * pi * pi / ( waveNumber * waveNumber );
-
-  // interpolate on the resonance parameters at this energy and get the level
-  // spacing and widths
-  const auto parameters = this->resonanceTable()( energy );
-  const auto spacing = parameters.levelSpacing();
-  const Degrees degrees = this->resonanceTable().degreesOfFreedom();
-  const double vl = degrees.elastic * penetrability / ratio; // ENDF D.98
-  const Widths widths{ parameters.elastic() * sqrt( energy ) * vl ,
-                       parameters.capture(),
-                       parameters.fission(),
-                       parameters.competition() };
-
-  // calculate the fluctuation integrals
-  const FluctuationIntegrals integrals =
-    calculateFluctuationIntegrals( widths, degrees );
-
-  // calculate the resulting cross sections
-  result[ this->elasticID() ] +=
-    factor * ( spinFactor / spacing *
-    ( widths.elastic * ( widths.elastic * integrals.elastic - 2. * sin2phi ) ) );
-  result[ this->captureID() ] +=
-    factor * spinFactor / spacing *
-    ( widths.elastic * widths.capture * integrals.capture );
-  if ( widths.hasFission() ) {
-
-    result[ this->fissionID() ] +=
-      factor * spinFactor / spacing *
-      ( widths.elastic * widths.fission * integrals.fission );
-  }
+               std::map< ReactionID, CrossSection >& result ) const {
+
+  this->accumulate( this->crossSections( energy ), result );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  The cross section values (in barn) are accumulated in a dense array using
+ *  the reaction slots of the l,J pair (see internReactions()).
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a dense array containing the accumulated cross
+ *                          sections
+ */
+void evaluate( const Energy& energy, std::vector< double >& result ) const {
+
+  this->accumulate( this->crossSections( energy ), result );
+}
+
+/**
+ *  @brief Evaluate the cross sections at the given energy
+ *
+ *  The unresolved resonance evaluation does not require any scratch data so
+ *  the workspace is not used.
+ *
+ *  @param[in] energy       the incident energy
+ *  @param[in,out] result   a map or dense array containing the accumulated
+ *                          cross sections
+ */
+template < typename Result >
+void evaluate( const Energy& energy, Result& result,
+               SpinGroupWorkspace& ) const {
+
+  this->evaluate( energy, result );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  The cross section values (in barn) and their derivatives (in barn/eV) are
+ *  accumulated in dense arrays using the reaction slots of the l,J pair (see
+ *  internReactions()). The derivatives are calculated analytically together
+ *  with the cross sections, which requires energy independent channel radii.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative ) const {
+
+  const auto values = this->crossSectionDerivatives( energy );
+  this->accumulate( values.first, result );
+  this->accumulate( values.second, derivative );
+}
+
+/**
+ *  @brief Evaluate the cross sections and their derivatives with respect to
+ *         the incident energy at the given energy
+ *
+ *  The unresolved resonance evaluation does not require any scratch data so
+ *  the workspace is not used.
+ *
+ *  @param[in] energy           the incident energy
+ *  @param[in,out] result       a dense array containing the accumulated cross
+ *                              sections
+ *  @param[in,out] derivative   a dense array containing the accumulated cross
+ *                              section derivatives
+ */
+void evaluate( const Energy& energy, std::vector< double >& result,
+               std::vector< double >& derivative,
+               SpinGroupWorkspace& ) const {
+
+  this->evaluate( energy, result, derivative );
 }
@@ -1112,5 +1112,33 @@ SCENARIO( "evaluate" ) {
       CHECK( 2.1100119938459196E-002 == Approx( xs[ capt ].value ) );
       xs.clear();
     } // THEN
+
+    THEN( "cross section derivatives can be calculated for l=0" ) {
+
+      for ( double energy : { 2600., 3010., 5000., 12000., 25000. } ) {
+
+        std::vector< double > xs( 3, 0. );
+        std::vector< double > values( 3, 0. );
+        std::vector< double > derivatives( 3, 0. );
+        group00.evaluate( energy * electronVolt, xs );
+        group00.evaluate( energy * electronVolt, values, derivatives );
+        CHECK( xs[0] == Approx( values[0] ) );
+        CHECK( xs[1] == Approx( values[1] ) );
+        CHECK( xs[2] == Approx( values[2] ) );
+
+        // compare with a central finite difference
+        const double h = 1e-6 * energy;
+        std::vector< double > upper( 3, 0. );
+        std::vector< double > lower( 3, 0. );
+        group00.evaluate( ( energy + h ) * electronVolt, upper );
+        group00.evaluate( ( energy - h ) * electronVolt, lower );
+        CHECK( ( upper[0] - lower[0] ) / ( 2. * h ) ==
+               Approx( derivatives[0] ).epsilon( 1e-5 ) );
+        CHECK( ( upper[1] - lower[1] ) / ( 2. * h ) ==
+               Approx( derivatives[1] ).epsilon( 1e-5 ) );
+        CHECK( ( upper[2] - lower[2] ) / ( 2. * h ) ==
+               Approx( derivatives[2] ).epsilon( 1e-5 ) );
+      }
+    } // THEN
   } // GIVEN
 } // SCENARIO
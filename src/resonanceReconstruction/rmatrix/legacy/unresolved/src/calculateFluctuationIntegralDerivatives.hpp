@@ -0,0 +1,83 @@
+/**
+ *  @brief Calculate the derivatives of the fluctuation integrals for the
+ *         legacy unresolved resonance with respect to the energy
+ *
+ *  The derivatives are obtained by deriving the MC-II quadrature used in
+ *  calculateFluctuationIntegrals() with respect to the widths, so that they
+ *  are consistent with the fluctuation integrals themselves.
+ *
+ *  @param widths        the full widths for which to calculate the integrals
+ *  @param derivatives   the derivatives of the full widths (in eV/eV)
+ *  @param degrees       the degrees of freedom for each width
+ *
+ *  @return the derivatives of the fluctuation integrals (in 1/eV^2)
+ */
+Data< double >
+calculateFluctuationIntegralDerivatives( const Widths& widths,
+                                         const Data< double >& derivatives,
+                                         const Degrees& degrees ) {
+
+  static constexpr FluctuationQuadrature quadrature =
+      makeFluctuationQuadrature();
+
+  // the widths and their derivatives as raw values (in eV and eV/eV)
+  const double elastic = widths.elastic.value;
+  const double capture = widths.capture.value;
+  const double fission = widths.fission.value;
+  const double competition = widths.competition.value;
+  const double delastic = derivatives.elastic;
+  const double dcapture = derivatives.capture;
+  const double dfission = derivatives.fission;
+  const double dcompetition = derivatives.competition;
+
+  // the quadrature for each reaction
+  const unsigned int mu = degrees.elastic - 1;
+  const unsigned int nu = degrees.hasFission() ? degrees.fission - 1 : 0;
+  const unsigned int lambda = degrees.hasCompetition()
+                              ? degrees.competition - 1 : 0;
+  const auto& qe = quadrature.q[ mu ];
+  const auto& qwe = quadrature.qw[ mu ];
+  const auto& qqwe = quadrature.qqw[ mu ];
+
+  // a zero fission or competition width reduces the corresponding quadrature
+  // to a single point with q = 0 and w = 1
+  const bool hasFission = widths.hasFission();
+  const bool hasCompetition = widths.hasCompetition();
+  const unsigned int nf = hasFission ? 10 : 1;
+  const unsigned int nc = hasCompetition ? 10 : 1;
+
+  double integrals[4] = { 0., 0., 0., 0. };
+  for ( unsigned int j = 0; j < nf; ++j ) {
+
+    const double qf = hasFission ? quadrature.q[ nu ][j] : 0.;
+    const double wf = hasFission ? quadrature.w[ nu ][j] : 1.;
+
+    for ( unsigned int k = 0; k < nc; ++k ) {
+
+      const double qc = hasCompetition ? quadrature.q[ lambda ][k] : 0.;
+      const double wc = hasCompetition ? quadrature.w[ lambda ][k] : 1.;
+
+      // the derivatives of the sums over the elastic quadrature points
+      const double offset = capture + qf * fission + qc * competition;
+      const double doffset = dcapture + qf * dfission + qc * dcompetition;
+      double first = 0.;
+      double second = 0.;
+      for ( unsigned int i = 0; i < 10; ++i ) {
+
+        const double inverse = 1. / ( qe[i] * elastic + offset );
+        const double dinverse = - ( qe[i] * delastic + doffset )
+                                * inverse * inverse;
+        first += qwe[i] * dinverse;
+        second += qqwe[i] * dinverse;
+      }
+
+      const double weight = wf * wc;
+      integrals[0] += weight * second;
+      integrals[1] += weight * first;
+      integrals[2] += qf * weight * first;
+      integrals[3] += qc * weight * first;
+    }
+  }
+
+  return { integrals[0], integrals[1], integrals[2], integrals[3] };
+}
@@ -0,0 +1,52 @@
+SCENARIO( "calculateFluctuationIntegralDerivatives" ) {
+
+  GIVEN( "valid values for the widths and their derivatives" ) {
+
+    // the widths as a function of a parameter t ( widths + t * derivatives )
+    auto widths = [] ( double t ) {
+
+      return Widths( ( 4.75405e-2 + t * 1.2e-5 ) * electronVolts,
+                     ( 4.07e-2 - t * 3.0e-6 ) * electronVolts,
+                     ( 2.842 + t * 4.0e-4 ) * electronVolts,
+                     ( 0.402 - t * 2.0e-4 ) * electronVolts );
+    };
+    Data< double > derivatives( 1.2e-5, -3.0e-6, 4.0e-4, -2.0e-4 );
+
+    THEN( "the derivatives correspond to the finite difference of the "
+          "fluctuation integrals" ) {
+
+      Degrees degrees( 1, 0, 2, 3 );
+      Data< double > values =
+      calculateFluctuationIntegralDerivatives( widths( 0. ), derivatives,
+                                               degrees );
+
+      const double h = 1e-3;
+      FluctuationIntegrals upper =
+      calculateFluctuationIntegrals( widths( h ), degrees );
+      FluctuationIntegrals lower =
+      calculateFluctuationIntegrals( widths( -h ), degrees );
+
+      CHECK( ( upper.elastic.value - lower.elastic.value ) / ( 2. * h ) ==
+             Approx( values.elastic ).epsilon( 1e-6 ) );
+      CHECK( ( upper.capture.value - lower.capture.value ) / ( 2. * h ) ==
+             Approx( values.capture ).epsilon( 1e-6 ) );
+      CHECK( ( upper.fission.value - lower.fission.value ) / ( 2. * h ) ==
+             Approx( values.fission ).epsilon( 1e-6 ) );
+      CHECK( ( upper.competition.value - lower.competition.value )
+             / ( 2. * h ) == Approx( values.competition ).epsilon( 1e-6 ) );
+    } // THEN
+
+    THEN( "the derivatives are zero when the widths are constant" ) {
+
+      Degrees degrees( 1, 0, 2, 3 );
+      Data< double > values =
+      calculateFluctuationIntegralDerivatives(
+          widths( 0. ), Data< double >( 0., 0., 0., 0. ), degrees );
+
+      CHECK( 0. == Approx( values.elastic ) );
+      CHECK( 0. == Approx( values.capture ) );
+      CHECK( 0. == Approx( values.fission ) );
+      CHECK( 0. == Approx( values.competition ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
@@ -10,5 +10,7 @@ using namespace njoy::resonanceReconstruction::rmatrix::legacy::unresolved;
 using Degrees = rmatrix::legacy::unresolved::Degrees;
 using Widths = rmatrix::legacy::unresolved::Widths;
 using FluctuationIntegrals = rmatrix::legacy::unresolved::FluctuationIntegrals;
+template < typename Quantity > using Data = rmatrix::legacy::Data< Quantity >;
 
+#include "resonanceReconstruction/rmatrix/legacy/unresolved/test/calculateFluctuationIntegralDerivatives.test.hpp"
 #include "resonanceReconstruction/rmatrix/legacy/unresolved/test/calculateFluctuationIntegrals.test.hpp"
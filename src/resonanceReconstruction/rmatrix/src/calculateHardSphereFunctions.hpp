@@ -0,0 +1,269 @@
+/**
+ *  @brief Calculate the arc tangent without branching
+ *
+ *  The argument is reduced to [-tan(pi/8),tan(pi/8)] after which a rational
+ *  approximation is used (the same reduction and approximation as the Cephes
+ *  library). The result is within 1 ulp of std::atan.
+ *
+ *  The reduced arguments for all three regions are calculated and each of them
+ *  is used to decide whether or not its region applies, while the offsets are
+ *  selected using std::copysign. This function therefore does not require a
+ *  function call or a conditional floating point operation so that loops using
+ *  it can be vectorised by the compiler (without having to relax the floating
+ *  point semantics).
+ *
+ *  @param[in] value   the argument
+ */
+inline double arcTangent( const double value ) {
+
+  constexpr double pi8 = 0.125 * pi;
+  constexpr double morebits = 6.123233995736765886130e-17;
+  constexpr double morebits4 = 0.25 * morebits;
+
+  // the reduced arguments: ( x - 1 ) / ( x + 1 ) for 0.66 < x <= tan(3pi/8)
+  // and -1 / x for x > tan(3pi/8), otherwise x itself
+  const double x = std::abs( value );
+  const double shifted = ( x - 1. ) / ( x + 1. );
+  const double inverted = -1. / x;
+
+  // the region boundaries: negative values indicate the region applies (the
+  // medium boundary is also negative in the big region, where shifted is NaN
+  // for an infinite argument)
+  const double big = -0.4142135623730951 - inverted;
+  const double medium = std::min( big, -0.2048192771084337 - shifted );
+
+  const double z = big < 0. ? inverted : medium < 0. ? shifted : x;
+  const double offset = ( pi8 - std::copysign( pi8, medium ) )
+                        + ( pi8 - std::copysign( pi8, big ) );
+  const double correction = ( morebits4 - std::copysign( morebits4, medium ) )
+                            + ( morebits4 - std::copysign( morebits4, big ) );
+
+  const double zz = z * z;
+  const double p = ( ( ( -8.750608600031904122785e-1 * zz
+                         - 1.615753718733365076637e+1 ) * zz
+                       - 7.500855792314704667340e+1 ) * zz
+                     - 1.228866684490136173410e+2 ) * zz
+                   - 6.485021904942025371773e+1;
+  const double q = ( ( ( ( zz + 2.485846490142306297962e+1 ) * zz
+                         + 1.650270098316988542046e+2 ) * zz
+                       + 4.328810604912902668951e+2 ) * zz
+                     + 4.853903996359136964868e+2 ) * zz
+                   + 1.945506571482613964425e+2;
+  return std::copysign( offset + ( ( z + z * zz * p / q ) + correction ),
+                        value );
+}
+
+/**
+ *  @brief The closed form of the neutron hard sphere penetrability
+ *
+ *  @param[in] ratio   the value of rho = ka
+ */
+template < unsigned int l >
+double hardSpherePenetrability( const double ratio ) {
+
+  static_assert( l <= 4, "closed forms are only available for l <= 4" );
+  const double x = ratio * ratio;
+  if constexpr ( l == 0 ) {
+
+    return ratio;
+  }
+  else if constexpr ( l == 1 ) {
+
+    return ratio * x / ( 1. + x );
+  }
+  else if constexpr ( l == 2 ) {
+
+    return ratio * x * x / ( 9. + x * ( 3. + x ) );
+  }
+  else if constexpr ( l == 3 ) {
+
+    return ratio * x * x * x / ( 225. + x * ( 45. + x * ( 6. + x ) ) );
+  }
+  else {
+
+    return ratio * x * x * x * x
+           / ( 11025. + x * ( 1575. + x * ( 135. + x * ( 10. + x ) ) ) );
+  }
+}
+
+/**
+ *  @brief The closed form of the neutron hard sphere shift factor
+ *
+ *  @param[in] ratio   the value of rho = ka
+ */
+template < unsigned int l >
+double hardSphereShiftFactor( const double ratio ) {
+
+  static_assert( l <= 4, "closed forms are only available for l <= 4" );
+  const double x = ratio * ratio;
+  if constexpr ( l == 0 ) {
+
+    return 0.;
+  }
+  else if constexpr ( l == 1 ) {
+
+    return - 1. / ( 1. + x );
+  }
+  else if constexpr ( l == 2 ) {
+
+    return - ( 18. + 3. * x ) / ( 9. + x * ( 3. + x ) );
+  }
+  else if constexpr ( l == 3 ) {
+
+    return - ( 675. + x * ( 90. + 6. * x ) )
+           / ( 225. + x * ( 45. + x * ( 6. + x ) ) );
+  }
+  else {
+
+    return - ( 44100. + x * ( 4725. + x * ( 270. + 10. * x ) ) )
+           / ( 11025. + x * ( 1575. + x * ( 135. + x * ( 10. + x ) ) ) );
+  }
+}
+
+/**
+ *  @brief The closed form of the neutron hard sphere phase shift
+ *
+ *  @param[in] ratio   the value of rho = ka
+ */
+template < unsigned int l >
+double hardSpherePhaseShift( const double ratio ) {
+
+  static_assert( l <= 4, "closed forms are only available for l <= 4" );
+  const double x = ratio * ratio;
+  if constexpr ( l == 0 ) {
+
+    return ratio;
+  }
+  else if constexpr ( l == 1 ) {
+
+    return ratio - arcTangent( ratio );
+  }
+  else if constexpr ( l == 2 ) {
+
+    return ratio - arcTangent( 3. * ratio / ( 3. - x ) );
+  }
+  else if constexpr ( l == 3 ) {
+
+    return ratio - arcTangent( ratio * ( 15. - x ) / ( 15. - 6. * x ) );
+  }
+  else {
+
+    return ratio - arcTangent( ratio * ( 105. - 10. * x )
+                               / ( 105. + x * ( -45. + x ) ) );
+  }
+}
+
+/**
+ *  @brief Calculate the neutron hard sphere penetrability, shift factor and
+ *         phase shift for a batch of values of rho = ka
+ *
+ *  The orbital angular momentum is a template parameter so that the closed
+ *  forms are selected at compile time. These do not contain any branching or
+ *  function calls, which allows the compiler to vectorise the loop over the
+ *  values of rho. The resulting values are identical to the ones given by
+ *  calculatePenetrability, calculateShiftFactor and calculatePhaseShift for a
+ *  neutron channel.
+ *
+ *  @param[in] size                  the number of values of rho
+ *  @param[in] penetrabilityRatios   the values of rho for the penetrability
+ *  @param[in] shiftFactorRatios     the values of rho for the shift factor
+ *  @param[in] phaseShiftRatios      the values of rho for the phase shift
+ *  @param[out] penetrability        the penetrability values
+ *  @param[out] shiftFactor          the shift factor values
+ *  @param[out] phaseShift           the phase shift values
+ */
+template < unsigned int l >
+void calculateHardSphereFunctions( const std::size_t size,
+                                   const double* penetrabilityRatios,
+                                   const double* shiftFactorRatios,
+                                   const double* phaseShiftRatios,
+                                   double* penetrability,
+                                   double* shiftFactor,
+                                   double* phaseShift ) {
+
+  // separate loops so that each loop only reads and writes a single array
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    penetrability[i] = hardSpherePenetrability< l >( penetrabilityRatios[i] );
+  }
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    shiftFactor[i] = hardSphereShiftFactor< l >( shiftFactorRatios[i] );
+  }
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    phaseShift[i] = hardSpherePhaseShift< l >( phaseShiftRatios[i] );
+  }
+}
+
+/**
+ *  @brief Calculate the neutron hard sphere penetrability, shift factor and
+ *         phase shift for a batch of values of rho = ka
+ *
+ *  This function dispatches to the compile time version for l <= 4 and uses
+ *  the recurrence relations for any higher value of l.
+ *
+ *  @param[in] l                     the orbital angular momentum
+ *  @param[in] size                  the number of values of rho
+ *  @param[in] penetrabilityRatios   the values of rho for the penetrability
+ *  @param[in] shiftFactorRatios     the values of rho for the shift factor
+ *  @param[in] phaseShiftRatios      the values of rho for the phase shift
+ *  @param[out] penetrability        the penetrability values
+ *  @param[out] shiftFactor          the shift factor values
+ *  @param[out] phaseShift           the phase shift values
+ */
+inline void calculateHardSphereFunctions( const unsigned int l,
+                                          const std::size_t size,
+                                          const double* penetrabilityRatios,
+                                          const double* shiftFactorRatios,
+                                          const double* phaseShiftRatios,
+                                          double* penetrability,
+                                          double* shiftFactor,
+                                          double* phaseShift ) {
+
+  switch ( l ) {
+
+    case 0 : return calculateHardSphereFunctions< 0 >(
+                        size, penetrabilityRatios, shiftFactorRatios,
+                        phaseShiftRatios, penetrability, shiftFactor,
+                        phaseShift );
+    case 1 : return calculateHardSphereFunctions< 1 >(
+                        size, penetrabilityRatios, shiftFactorRatios,
+                        phaseShiftRatios, penetrability, shiftFactor,
+                        phaseShift );
+    case 2 : return calculateHardSphereFunctions< 2 >(
+                        size, penetrabilityRatios, shiftFactorRatios,
+                        phaseShiftRatios, penetrability, shiftFactor,
+                        phaseShift );
+    case 3 : return calculateHardSphereFunctions< 3 >(
+                        size, penetrabilityRatios, shiftFactorRatios,
+                        phaseShiftRatios, penetrability, shiftFactor,
+                        phaseShift );
+    case 4 : return calculateHardSphereFunctions< 4 >(
+                        size, penetrabilityRatios, shiftFactorRatios,
+                        phaseShiftRatios, penetrability, shiftFactor,
+                        phaseShift );
+    default : {
+
+      // the recurrence is only performed once when the same value of rho is
+      // used for all three functions (the usual case)
+      for ( std::size_t i = 0; i < size; ++i ) {
+
+        if ( ( penetrabilityRatios[i] == shiftFactorRatios[i] ) and
+             ( penetrabilityRatios[i] == phaseShiftRatios[i] ) ) {
+
+          const auto values = hardSphereFunctions( l, penetrabilityRatios[i] );
+          penetrability[i] = values[0];
+          shiftFactor[i] = values[1];
+          phaseShift[i] = values[2];
+        }
+        else {
+
+          penetrability[i] = hardSphereFunctions( l, penetrabilityRatios[i] )[0];
+          shiftFactor[i] = hardSphereFunctions( l, shiftFactorRatios[i] )[1];
+          phaseShift[i] = hardSphereFunctions( l, phaseShiftRatios[i] )[2];
+        }
+      }
+    }
+  }
+}
@@ -14,7 +14,9 @@ double calculatePenetrability( const unsigned int, const double, const double )
  *  @brief The penetrability for neutron channels
  *
  *  For a neutron channel, the penetrability is defined using the neutron
- *  hardsphere functions.
+ *  hardsphere functions. Closed forms are used for l <= 4 (see
+ *  hardSpherePenetrability()), higher values of l use the recurrence
+ *  relations implemented in hardSphereFunctions().
  *
  *  @param[in] l       the oribital angular momentum
  *  @param[in] ratio   the value of rho = ka
@@ -24,33 +26,14 @@ double calculatePenetrability< Neutron >( const unsigned int l,
                                           const double ratio,
                                           const double  ) {
 
-  double squared = ratio * ratio;
   switch ( l ) {
 
-    case 0 : return ratio;
-    case 1 : return ratio * squared / ( 1. + squared );
-    case 2 : {
-
-      constexpr std::array< double, 3 > denominator = {{ 9., 3., 1. }};
-      return ratio * squared * squared
-             / horner( std::rbegin( denominator ), std::rend( denominator ),
-                       squared );
-    }
-    case 3 : {
-
-      constexpr std::array< double, 4 > denominator = {{ 225., 45., 6., 1. }};
-      return ratio * squared * squared * squared
-             / horner( std::rbegin( denominator ), std::rend( denominator ),
-                       squared );
-    }
-    case 4 : {
-
-      constexpr std::array< double, 5 > denominator = {{ 11025., 1575., 135., 10., 1. }};
-      return ratio * squared * squared * squared * squared
-             / horner( std::rbegin( denominator ), std::rend( denominator ),
-                       squared );
-    }
-    default : throw std::exception();
+    case 0 : return hardSpherePenetrability< 0 >( ratio );
+    case 1 : return hardSpherePenetrability< 1 >( ratio );
+    case 2 : return hardSpherePenetrability< 2 >( ratio );
+    case 3 : return hardSpherePenetrability< 3 >( ratio );
+    case 4 : return hardSpherePenetrability< 4 >( ratio );
+    default : return hardSphereFunctions( l, ratio )[0];
   }
 }
 
@@ -69,11 +52,7 @@ double calculatePenetrability< ChargedParticle >( const unsigned int l,
                                                   const double ratio,
                                                   const double eta ) {
 
-
   std::complex< double > gf, dgf;
   coulombWaveFunctions( l, ratio, eta, gf, dgf);
-
-  double F = gf.imag();
-  double G = gf.real();
-  return ( F == 0. ) and ( G == 0. ) ? 0. : ratio / ( F * F + G * G );
+  return penetrabilityFromCoulombFunctions( ratio, gf );
 }
@@ -14,7 +14,9 @@ double calculatePhaseShift( const unsigned int, const double, const double ) {
  *  @brief The phase shift for neutron channels
  *
  *  For a neutron channel, the phase shift is defined using the neutron
- *  hardsphere functions.
+ *  hardsphere functions. Closed forms are used for l <= 4 (see
+ *  hardSpherePhaseShift()), higher values of l use the recurrence relations
+ *  implemented in hardSphereFunctions().
  *
  *  @param[in] l       the oribital angular momentum
  *  @param[in] ratio   the value of rho = ka
@@ -24,28 +26,14 @@ double calculatePhaseShift< Neutron >( const unsigned int l,
                                        const double ratio,
                                        const double ) {
 
-  double squared = ratio * ratio;
   switch ( l ) {
 
-    case 0 : return ratio;
-    case 1 : return ratio - std::atan( ratio );
-    case 2 : {
-
-      double offset = 3. * ratio / ( 3. - squared );
-      return ratio - std::atan( offset );
-    }
-    case 3 : {
-
-      double offset = ratio * ( 15. - squared ) / ( 15. - 6. * squared );
-      return ratio - std::atan( offset );
-    }
-    case 4 : {
-
-      constexpr std::array< double, 3 > denominator = {{ 105., -45., 1. }};
-      double offset = ratio * ( 105. - 10. * squared ) / horner( std::rbegin( denominator ), std::rend( denominator ), squared );
-      return ratio - std::atan( offset );
-    }
-    default : throw std::exception();
+    case 0 : return hardSpherePhaseShift< 0 >( ratio );
+    case 1 : return hardSpherePhaseShift< 1 >( ratio );
+    case 2 : return hardSpherePhaseShift< 2 >( ratio );
+    case 3 : return hardSpherePhaseShift< 3 >( ratio );
+    case 4 : return hardSpherePhaseShift< 4 >( ratio );
+    default : return hardSphereFunctions( l, ratio )[2];
   }
 }
 
@@ -66,10 +54,5 @@ double calculatePhaseShift< ChargedParticle >( const unsigned int l,
 
   std::complex< double > gf, dgf;
   coulombWaveFunctions( l, ratio, eta, gf, dgf);
-
-  double F = gf.imag();
-  double G = gf.real();
-  return ( F == 0. ) and ( G == 0. )
-           ? 0.
-           : std::acos( G / std::sqrt( F * F + G * G ) );
+  return phaseShiftFromCoulombFunctions( gf );
 }
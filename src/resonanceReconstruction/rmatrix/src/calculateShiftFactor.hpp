@@ -13,40 +13,23 @@ double calculateShiftFactor( const unsigned int, const double, const double ) {
  *  @brief The penetrability for neutron channels
  *
  *  For a neutron channel, the shift factor is defined using the neutron
- *  hardsphere functions.
+ *  hardsphere functions. Closed forms are used for l <= 4 (see
+ *  hardSphereShiftFactor()), higher values of l use the recurrence relations
+ *  implemented in hardSphereFunctions().
  */
 template <>
 double calculateShiftFactor< Neutron >( const unsigned int l,
                                         const double ratio,
                                         const double ) {
 
-  double squared = ratio * ratio;
   switch ( l ) {
 
-    case 0 : return 0.;
-    case 1 : return - 1. / ( 1. + squared );
-    case 2 : {
-
-      constexpr std::array< double, 2 > numerator = {{ 18., 3. }};
-      constexpr std::array< double, 3 > denominator = {{ 9., 3., 1. }};
-      return -horner( std::rbegin( numerator ), std::rend( numerator ), squared )
-             / horner( std::rbegin( denominator ), std::rend( denominator ), squared );
-    }
-    case 3 : {
-
-      constexpr std::array< double, 3 > numerator = {{ 675., 90., 6. }};
-      constexpr std::array< double, 4 > denominator = {{ 225., 45., 6., 1. }};
-      return -horner( std::rbegin( numerator ), std::rend( numerator ), squared )
-             / horner( std::rbegin( denominator ), std::rend( denominator ), squared );
-    }
-    case 4 : {
-
-      constexpr std::array< double, 4 > numerator = {{ 44100., 4725., 270., 10. }};
-      constexpr std::array< double, 5 > denominator = {{ 11025., 1575., 135., 10., 1. }};
-      return -horner( std::rbegin( numerator ), std::rend( numerator ), squared )
-             / horner( std::rbegin( denominator ), std::rend( denominator ), squared );
-    }
-    default : throw std::exception();
+    case 0 : return hardSphereShiftFactor< 0 >( ratio );
+    case 1 : return hardSphereShiftFactor< 1 >( ratio );
+    case 2 : return hardSphereShiftFactor< 2 >( ratio );
+    case 3 : return hardSphereShiftFactor< 3 >( ratio );
+    case 4 : return hardSphereShiftFactor< 4 >( ratio );
+    default : return hardSphereFunctions( l, ratio )[1];
   }
 }
 
@@ -67,12 +50,5 @@ double calculateShiftFactor< ChargedParticle >( const unsigned int l,
 
   std::complex< double > gf, dgf;
   coulombWaveFunctions( l, ratio, eta, gf, dgf);
-
-  double F = gf.imag();
-  double G = gf.real();
-  double dF = dgf.imag();
-  double dG = dgf.real();
-  return ( F == 0. ) and ( G == 0. )
-           ? 0.
-           : ratio / ( F * F + G * G ) * ( F * dF + G * dG );
+  return shiftFactorFromCoulombFunctions( ratio, gf, dgf );
 }
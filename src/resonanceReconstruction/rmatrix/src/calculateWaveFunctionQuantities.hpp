@@ -0,0 +1,85 @@
+/**
+ *  @brief Calculate the penetrability, shift factor and phase shift at once
+ *
+ *  For all channel types except for charged particle channels, this is
+ *  equivalent to calling calculatePenetrability(), calculateShiftFactor() and
+ *  calculatePhaseShift().
+ *
+ *  @param[in] l                    the oribital angular momentum
+ *  @param[in] penetrabilityRatio   the value of rho = ka for the penetrability
+ *  @param[in] shiftFactorRatio     the value of rho = ka for the shift factor
+ *  @param[in] phaseShiftRatio      the value of rho = ka for the phase shift
+ *  @param[in] eta                  the Sommerfeld parameter
+ *  @param[out] penetrability       the penetrability
+ *  @param[out] shiftFactor         the shift factor
+ *  @param[out] phaseShift          the phase shift
+ */
+template < typename Type >
+void calculateWaveFunctionQuantities( const unsigned int l,
+                                      const double penetrabilityRatio,
+                                      const double shiftFactorRatio,
+                                      const double phaseShiftRatio,
+                                      const double eta,
+                                      double& penetrability,
+                                      double& shiftFactor,
+                                      double& phaseShift ) {
+
+  penetrability = calculatePenetrability< Type >( l, penetrabilityRatio, eta );
+  shiftFactor = calculateShiftFactor< Type >( l, shiftFactorRatio, eta );
+  phaseShift = calculatePhaseShift< Type >( l, phaseShiftRatio, eta );
+}
+
+/**
+ *  @brief Calculate the penetrability, shift factor and phase shift at once
+ *         for charged particle channels
+ *
+ *  The Coulomb wave functions are only evaluated once for every distinct
+ *  value of rho (in most cases, the same channel radius is used for all three
+ *  quantities so that only a single evaluation is required). The resulting
+ *  values are identical to the ones obtained using calculatePenetrability(),
+ *  calculateShiftFactor() and calculatePhaseShift().
+ *
+ *  @param[in] l                    the oribital angular momentum
+ *  @param[in] penetrabilityRatio   the value of rho = ka for the penetrability
+ *  @param[in] shiftFactorRatio     the value of rho = ka for the shift factor
+ *  @param[in] phaseShiftRatio      the value of rho = ka for the phase shift
+ *  @param[in] eta                  the Sommerfeld parameter
+ *  @param[out] penetrability       the penetrability
+ *  @param[out] shiftFactor         the shift factor
+ *  @param[out] phaseShift          the phase shift
+ */
+template <>
+void calculateWaveFunctionQuantities< ChargedParticle >(
+         const unsigned int l,
+         const double penetrabilityRatio,
+         const double shiftFactorRatio,
+         const double phaseShiftRatio,
+         const double eta,
+         double& penetrability,
+         double& shiftFactor,
+         double& phaseShift ) {
+
+  std::complex< double > gf, dgf;
+  coulombWaveFunctions( l, penetrabilityRatio, eta, gf, dgf );
+  penetrability = penetrabilityFromCoulombFunctions( penetrabilityRatio, gf );
+
+  if ( shiftFactorRatio == penetrabilityRatio ) {
+
+    shiftFactor = shiftFactorFromCoulombFunctions( shiftFactorRatio, gf, dgf );
+  }
+  else {
+
+    shiftFactor = calculateShiftFactor< ChargedParticle >( l, shiftFactorRatio,
+                                                           eta );
+  }
+
+  if ( phaseShiftRatio == penetrabilityRatio ) {
+
+    phaseShift = phaseShiftFromCoulombFunctions( gf );
+  }
+  else {
+
+    phaseShift = calculatePhaseShift< ChargedParticle >( l, phaseShiftRatio,
+                                                         eta );
+  }
+}
@@ -15,9 +15,29 @@ const int MAX_L0           =  100;     /* maximum iteration for F function    */
 #include "coh3-asympt.hpp"
 #include "coh3-extwave.hpp"
 
-void coulombWaveFunctions( int l, double ratio, double eta,
-                           std::complex<double>& gf,
-                           std::complex<double>& dgf ) {
+/**
+ *  @brief Array type for the Coulomb wave functions for all l values
+ */
+using CoulombWaveFunctionArray = std::array< std::complex< double >, MAX_L >;
+
+/**
+ *  @brief Calculate the Coulomb wave functions G + iF and their derivatives
+ *         G' + iF' for all l values from 0 up to a given lmax
+ *
+ *  The values are stored in arrays provided by the caller so that no memory
+ *  is allocated. Values that could not be calculated (e.g. when the asymptotic
+ *  functions underflow at very low energies) are set to zero.
+ *
+ *  @param[in] lmax       the maximum orbital angular momentum (at most
+ *                        MAX_L - 2)
+ *  @param[in] ratio      the value of rho = ka
+ *  @param[in] eta        the Sommerfeld parameter
+ *  @param[out] gf        the values of G + iF for l = 0 to lmax
+ *  @param[out] dgf       the values of G' + iF' for l = 0 to lmax
+ */
+void coulombWaveFunctions( int lmax, double ratio, double eta,
+                           CoulombWaveFunctionArray& gf,
+                           CoulombWaveFunctionArray& dgf ) {
 
   double y2 = eta*eta;
   double y3 = 16.0 + y2;
@@ -27,12 +47,77 @@ void coulombWaveFunctions( int l, double ratio, double eta,
                   -eta*(1.+(y2-48.)/(30.*y4)+(y2*y2-160.*y2+1280.)/(105.*y4*y4))
                   /(12.*y3);
 
-  std::complex<double> *Cou0 = new std::complex<double>[MAX_L]; // G + iF
-  std::complex<double> *Cou1 = new std::complex<double>[MAX_L]; // G'+ iF'
-  omExternalFunction(l ,ratio, eta, sigma0, Cou0, Cou1);
+  gf.fill( 0. );
+  dgf.fill( 0. );
+  omExternalFunction(lmax ,ratio, eta, sigma0, gf.data(), dgf.data());
+}
+
+/**
+ *  @brief Calculate the Coulomb wave function G + iF and its derivative
+ *         G' + iF' for a single l value
+ *
+ *  @param[in] l          the orbital angular momentum
+ *  @param[in] ratio      the value of rho = ka
+ *  @param[in] eta        the Sommerfeld parameter
+ *  @param[out] gf        the value of G + iF
+ *  @param[out] dgf       the value of G' + iF'
+ */
+void coulombWaveFunctions( int l, double ratio, double eta,
+                           std::complex<double>& gf,
+                           std::complex<double>& dgf ) {
+
+  CoulombWaveFunctionArray Cou0; // G + iF
+  CoulombWaveFunctionArray Cou1; // G'+ iF'
+  coulombWaveFunctions(l, ratio, eta, Cou0, Cou1);
 
   gf  = Cou0[l];
   dgf = Cou1[l];
-  delete [] Cou0;
-  delete [] Cou1;
+}
+
+/**
+ *  @brief Return the penetrability derived from the Coulomb wave functions
+ *
+ *  @param[in] ratio   the value of rho = ka
+ *  @param[in] gf      the value of G + iF
+ */
+double penetrabilityFromCoulombFunctions( double ratio,
+                                          const std::complex<double>& gf ) {
+
+  double F = gf.imag();
+  double G = gf.real();
+  return ( F == 0. ) and ( G == 0. ) ? 0. : ratio / ( F * F + G * G );
+}
+
+/**
+ *  @brief Return the shift factor derived from the Coulomb wave functions
+ *
+ *  @param[in] ratio   the value of rho = ka
+ *  @param[in] gf      the value of G + iF
+ *  @param[in] dgf     the value of G' + iF'
+ */
+double shiftFactorFromCoulombFunctions( double ratio,
+                                        const std::complex<double>& gf,
+                                        const std::complex<double>& dgf ) {
+
+  double F = gf.imag();
+  double G = gf.real();
+  double dF = dgf.imag();
+  double dG = dgf.real();
+  return ( F == 0. ) and ( G == 0. )
+           ? 0.
+           : ratio / ( F * F + G * G ) * ( F * dF + G * dG );
+}
+
+/**
+ *  @brief Return the phase shift derived from the Coulomb wave functions
+ *
+ *  @param[in] gf      the value of G + iF
+ */
+double phaseShiftFromCoulombFunctions( const std::complex<double>& gf ) {
+
+  double F = gf.imag();
+  double G = gf.real();
+  return ( F == 0. ) and ( G == 0. )
+           ? 0.
+           : std::acos( G / std::sqrt( F * F + G * G ) );
 }
@@ -3,59 +3,29 @@ makeChannelRadiusTable( const std::optional< endf::ScatteringRadius >& radius )
 
   if ( radius ) {
 
-    auto makeTable = [] ( auto&& region, int interpolant )
-      -> TableVariant< Energy, ChannelRadius > {
+    auto toEnergy = [] ( const auto& value ) { return value * electronVolt; };
+    auto toRadius = [] ( const auto& value ) { return value * rootBarn; };
 
-      auto toEnergy = [] ( const auto& value ) { return value * electronVolt; };
-      auto toRadius = [] ( const auto& value ) { return value * rootBarn; };
+    std::vector< std::vector< Energy > > energies;
+    std::vector< std::vector< ChannelRadius > > radii;
+    for ( const auto& region : radius->regions() ) {
 
-      std::vector< Energy > energies =
-          region.first | ranges::view::transform( toEnergy );
-      std::vector< ChannelRadius > radii =
-          region.second | ranges::view::transform( toRadius );
+      std::vector< Energy > x = region.first
+                                | ranges::view::transform( toEnergy );
+      std::vector< ChannelRadius > y = region.second
+                                       | ranges::view::transform( toRadius );
+      energies.push_back( std::move( x ) );
+      radii.push_back( std::move( y ) );
+    }
 
-      switch( interpolant ) {
+    std::vector< int > interpolants;
+    for ( const auto interpolant : radius->interpolants() ) {
 
-        case 1: {
+      interpolants.push_back( interpolant );
+    }
 
-          return HistogramTable< Energy, ChannelRadius >( std::move( energies ),
-                                                          std::move( radii ) );
-        }
-        case 2: {
-
-          return LinLinTable< Energy, ChannelRadius >( std::move( energies ),
-                                                       std::move( radii ) );
-        }
-        case 3: {
-
-          return LinLogTable< Energy, ChannelRadius >( std::move( energies ),
-                                                       std::move( radii ) );
-        }
-        case 4: {
-
-          return LogLinTable< Energy, ChannelRadius >( std::move( energies ),
-                                                       std::move( radii ) );
-        }
-        case 5: {
-
-          return LogLogTable< Energy, ChannelRadius >( std::move( energies ),
-                                                       std::move( radii ) );
-        }
-        default : {
-
-          throw std::runtime_error( "You somehow reached unreachable code" );
-        }
-      }
-    };
-
-    const auto regions = radius->regions();
-    const auto interpolants = radius->interpolants();
-    std::vector< TableVariant< Energy, ChannelRadius > > tables =
-      ranges::view::zip_with( makeTable, regions, interpolants );
-
-    ChannelRadiusTable table(
-        MultiRegionTable< Energy, ChannelRadius >( std::move( tables ) ) );
-    return std::make_optional( std::move( table ) );
+    return std::make_optional(
+             ChannelRadiusTable( energies, radii, interpolants ) );
   }
   return std::nullopt;
 }
@@ -0,0 +1,114 @@
+/**
+ *  @brief Return the number of threads to be used for a requested number of
+ *         threads
+ *
+ *  A requested number of threads equal to zero corresponds to the number of
+ *  concurrent threads supported by the hardware (or a single thread when that
+ *  number cannot be determined).
+ *
+ *  @param[in] threads   the requested number of threads
+ */
+inline unsigned int numberThreads( unsigned int threads ) {
+
+  if ( threads == 0 ) {
+
+    threads = std::thread::hardware_concurrency();
+  }
+  return std::max( threads, 1u );
+}
+
+/**
+ *  @brief Apply a function to an index range using a pool of threads
+ *
+ *  The index range [begin, end) is divided in chunks of the given size. The
+ *  chunks are handed out dynamically: a thread that has finished a chunk
+ *  takes the next chunk that has not been processed yet, so that threads
+ *  processing cheap chunks are not kept waiting for threads processing
+ *  expensive chunks.
+ *
+ *  The function is called as function( thread, first, last ) in which thread
+ *  is the index of the thread processing the chunk (between 0 and the number
+ *  of threads - 1) and [first, last) is the chunk itself. The calling thread
+ *  participates as the thread with index 0. Chunks processed by the same
+ *  thread index are never processed concurrently so the thread index can be
+ *  used to select per thread data.
+ *
+ *  When a function call throws an exception, no new chunks are handed out and
+ *  the first exception is rethrown once all threads have finished.
+ *
+ *  @param[in] begin      the first index of the range
+ *  @param[in] end        the index past the last index of the range
+ *  @param[in] chunk      the size of the chunks
+ *  @param[in] threads    the number of threads (at least 1, see
+ *                        numberThreads())
+ *  @param[in] function   the function to be applied to each chunk
+ */
+template < typename Function >
+void parallelFor( unsigned int begin, unsigned int end,
+                  unsigned int chunk, unsigned int threads,
+                  Function&& function ) {
+
+  if ( begin >= end ) {
+
+    return;
+  }
+
+  chunk = std::max( chunk, 1u );
+  const unsigned int chunks = ( end - begin - 1 ) / chunk + 1;
+  threads = std::min( std::max( threads, 1u ), chunks );
+
+  std::atomic< unsigned int > next( 0 );
+  std::atomic< bool > failed( false );
+  std::exception_ptr exception = nullptr;
+  std::mutex mutex;
+
+  auto work = [&] ( unsigned int thread ) {
+
+    try {
+
+      unsigned int current = next++;
+      while ( ( not failed ) and ( current < chunks ) ) {
+
+        const unsigned int first = begin + current * chunk;
+        const unsigned int last = end - first > chunk ? first + chunk : end;
+        function( thread, first, last );
+        current = next++;
+      }
+    }
+    catch ( ... ) {
+
+      std::lock_guard< std::mutex > lock( mutex );
+      if ( not exception ) {
+
+        exception = std::current_exception();
+      }
+      failed = true;
+    }
+  };
+
+  std::vector< std::thread > pool;
+  pool.reserve( threads - 1 );
+  try {
+
+    for ( unsigned int thread = 1; thread < threads; ++thread ) {
+
+      pool.emplace_back( work, thread );
+    }
+  }
+  catch ( const std::system_error& ) {
+
+    // the threads that could be started (including the calling thread) will
+    // process all chunks
+  }
+
+  work( 0 );
+  for ( auto& thread : pool ) {
+
+    thread.join();
+  }
+
+  if ( exception ) {
+
+    std::rethrow_exception( exception );
+  }
+}
@@ -0,0 +1,200 @@
+SCENARIO( "calculateHardSphereFunctions" ) {
+
+  GIVEN( "values for rho" ) {
+
+    THEN( "the recurrence relations reproduce the closed forms for l <= 4" ) {
+
+      for ( unsigned int l = 0; l <= 4; ++l ) {
+
+        for ( double ratio : { 0., 0.25, 1., 1.75, 2.5, 5., 10. } ) {
+
+          auto values = hardSphereFunctions( l, ratio );
+          CHECK( calculatePenetrability< Neutron >( l, ratio, 0. ) ==
+                 Approx( values[0] ) );
+          CHECK( calculateShiftFactor< Neutron >( l, ratio, 0. ) ==
+                 Approx( values[1] ) );
+          CHECK( calculatePhaseShift< Neutron >( l, ratio, 0. ) ==
+                 Approx( values[2] ) );
+        }
+      }
+    } // THEN
+
+    THEN( "values can be calculated for l > 4" ) {
+
+      /* reference values calculated using the spherical Hankel functions */
+
+      CHECK( 5.3176356671716987e-10 ==
+             Approx( calculatePenetrability< Neutron >( 5, 0.5, 0. ) ) );
+      CHECK( 0.012759180145597951 ==
+             Approx( calculatePenetrability< Neutron >( 5, 2.5, 0. ) ) );
+      CHECK( 1.752748983461677 ==
+             Approx( calculatePenetrability< Neutron >( 5, 5., 0. ) ) );
+      CHECK( 8.4112668574693856 ==
+             Approx( calculatePenetrability< Neutron >( 5, 10., 0. ) ) );
+      CHECK( -4.972110739792547 ==
+             Approx( calculateShiftFactor< Neutron >( 5, 0.5, 0. ) ) );
+      CHECK( -4.2067378035041898 ==
+             Approx( calculateShiftFactor< Neutron >( 5, 2.5, 0. ) ) );
+      CHECK( -1.5041715986686059 ==
+             Approx( calculateShiftFactor< Neutron >( 5, 5., 0. ) ) );
+      CHECK( -0.19877128381971429 ==
+             Approx( calculateShiftFactor< Neutron >( 5, 10., 0. ) ) );
+      CHECK( 3.1429067280480645 ==
+             Approx( calculatePhaseShift< Neutron >( 5, 2.5, 0. ) ) );
+      CHECK( 3.4633136609034745 ==
+             Approx( calculatePhaseShift< Neutron >( 5, 5., 0. ) ) );
+      CHECK( 9.9591763949578489 ==
+             Approx( calculatePhaseShift< Neutron >( 5, 10., 0. ) ) );
+
+      CHECK( 0.00076547002860175202 ==
+             Approx( calculatePenetrability< Neutron >( 6, 2.5, 0. ) ) );
+      CHECK( -5.3876603520583961 ==
+             Approx( calculateShiftFactor< Neutron >( 6, 2.5, 0. ) ) );
+      CHECK( 3.1416566544452107 ==
+             Approx( calculatePhaseShift< Neutron >( 6, 2.5, 0. ) ) );
+
+      CHECK( 0.030427589274436038 ==
+             Approx( calculatePenetrability< Neutron >( 8, 5., 0. ) ) );
+      CHECK( -5.9962573950874232 ==
+             Approx( calculateShiftFactor< Neutron >( 8, 5., 0. ) ) );
+      CHECK( 6.2854247478732503 ==
+             Approx( calculatePhaseShift< Neutron >( 8, 5., 0. ) ) );
+    } // THEN
+
+    THEN( "the batch values are identical to the individual values" ) {
+
+      std::vector< double > penetrabilityRatios = { 0., 0.25, 1., 1.75, 2.5, 5., 10. };
+      std::vector< double > shiftFactorRatios = { 0.5, 0.75, 1.5, 2., 3., 6., 12. };
+      std::vector< double > phaseShiftRatios = { 0.1, 0.66, 1.2, 1.8, 2.45, 4., 8. };
+      const std::size_t size = penetrabilityRatios.size();
+      std::vector< double > penetrability( size );
+      std::vector< double > shiftFactor( size );
+      std::vector< double > phaseShift( size );
+
+      for ( unsigned int l = 0; l <= 7; ++l ) {
+
+        calculateHardSphereFunctions( l, size, penetrabilityRatios.data(),
+                                      shiftFactorRatios.data(),
+                                      phaseShiftRatios.data(),
+                                      penetrability.data(), shiftFactor.data(),
+                                      phaseShift.data() );
+        for ( unsigned int i = 0; i < size; ++i ) {
+
+          CHECK( calculatePenetrability< Neutron >( l, penetrabilityRatios[i], 0. ) ==
+                 penetrability[i] );
+          CHECK( calculateShiftFactor< Neutron >( l, shiftFactorRatios[i], 0. ) ==
+                 shiftFactor[i] );
+          CHECK( calculatePhaseShift< Neutron >( l, phaseShiftRatios[i], 0. ) ==
+                 phaseShift[i] );
+        }
+      }
+    } // THEN
+
+    THEN( "the batch values are identical to the individual values when the "
+          "same values of rho are used for all three functions" ) {
+
+      std::vector< double > ratios = { 0., 0.25, 1., 1.75, 2.5, 5., 10. };
+      const std::size_t size = ratios.size();
+      std::vector< double > penetrability( size );
+      std::vector< double > shiftFactor( size );
+      std::vector< double > phaseShift( size );
+
+      for ( unsigned int l = 0; l <= 7; ++l ) {
+
+        calculateHardSphereFunctions( l, size, ratios.data(), ratios.data(),
+                                      ratios.data(), penetrability.data(),
+                                      shiftFactor.data(), phaseShift.data() );
+        for ( unsigned int i = 0; i < size; ++i ) {
+
+          CHECK( calculatePenetrability< Neutron >( l, ratios[i], 0. ) ==
+                 penetrability[i] );
+          CHECK( calculateShiftFactor< Neutron >( l, ratios[i], 0. ) ==
+                 shiftFactor[i] );
+          CHECK( calculatePhaseShift< Neutron >( l, ratios[i], 0. ) ==
+                 phaseShift[i] );
+        }
+      }
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "values for the arc tangent" ) {
+
+    THEN( "the branch free arc tangent agrees with std::atan" ) {
+
+      const double infinity = std::numeric_limits< double >::infinity();
+      for ( double value : { 0., 1e-300, 1e-8, 0.25, 0.66, 0.6600000000000001,
+                             1., 1.5, 2.414213562373095, 2.4142135623730954,
+                             10., 1e8, 1e300, infinity } ) {
+
+        CHECK( std::atan( value ) == Approx( arcTangent( value ) ).epsilon( 1e-15 ) );
+        CHECK( std::atan( -value ) == Approx( arcTangent( -value ) ).epsilon( 1e-15 ) );
+      }
+      CHECK( 0. == arcTangent( 0. ) );
+      CHECK( std::signbit( arcTangent( -0. ) ) );
+    } // THEN
+
+    THEN( "the branch free arc tangent is within one ulp of std::atan over "
+          "the full range of arguments" ) {
+
+      // the difference in ulp of std::atan( value ), for both signs
+      double worst = 0.;
+      auto verify = [&worst] ( double value ) {
+
+        for ( double x : { value, -value } ) {
+
+          const double reference = std::atan( x );
+          const double ulp =
+              std::abs( std::nextafter( reference, 2. * reference ) - reference );
+          if ( ulp > 0. ) {
+
+            worst = std::max( worst,
+                              std::abs( arcTangent( x ) - reference ) / ulp );
+          }
+          else {
+
+            worst = std::max( worst, std::abs( arcTangent( x ) - reference ) );
+          }
+        }
+      };
+
+      // logarithmic sweep from 1e-300 to 1e300
+      for ( int decade = -300; decade < 300; ++decade ) {
+
+        for ( int i = 0; i < 100; ++i ) {
+
+          verify( std::pow( 10., decade + i / 100. ) );
+        }
+      }
+
+      // linear sweep over the region where the reductions are applied
+      for ( int i = 0; i <= 200000; ++i ) {
+
+        verify( i * 1e-4 );
+      }
+
+      // the neighbours of the region boundaries: 0.66, tan(pi/8) and
+      // tan(3pi/8), as well as 1
+      for ( double split : { 0.66, 0.4142135623730951,
+                             2.414213562373095, 1. } ) {
+
+        double below = split;
+        double above = split;
+        for ( int i = 0; i < 10000; ++i ) {
+
+          verify( below );
+          verify( above );
+          below = std::nextafter( below, 0. );
+          above = std::nextafter( above, 10. );
+        }
+      }
+
+      // extreme values
+      verify( std::numeric_limits< double >::denorm_min() );
+      verify( std::numeric_limits< double >::min() );
+      verify( std::numeric_limits< double >::max() );
+      verify( std::numeric_limits< double >::infinity() );
+
+      CHECK( worst <= 1. );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
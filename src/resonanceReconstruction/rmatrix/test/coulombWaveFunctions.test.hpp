@@ -0,0 +1,80 @@
+SCENARIO( "coulombWaveFunctions" ) {
+
+  GIVEN( "values for rho and eta" ) {
+
+    THEN( "the values for all l are identical to the values for a single l" ) {
+
+      for ( double eta : { 0.0, 0.5, 3.17996084 } ) {
+
+        for ( double ratio : { 0.25, 0.818956, 2.5 } ) {
+
+          CoulombWaveFunctionArray gf, dgf;
+          coulombWaveFunctions( 5, ratio, eta, gf, dgf );
+          for ( int l = 0; l <= 5; ++l ) {
+
+            std::complex< double > value, derivative;
+            coulombWaveFunctions( l, ratio, eta, value, derivative );
+            CHECK( value.real() == Approx( gf[l].real() ) );
+            CHECK( value.imag() == Approx( gf[l].imag() ) );
+            CHECK( derivative.real() == Approx( dgf[l].real() ) );
+            CHECK( derivative.imag() == Approx( dgf[l].imag() ) );
+
+            // wronskian: F'G - FG' = 1
+            CHECK( 1.0 == Approx( dgf[l].imag() * gf[l].real() -
+                                  gf[l].imag() * dgf[l].real() ) );
+          }
+        }
+      }
+    } // THEN
+
+    THEN( "the hard sphere functions are obtained for eta = 0" ) {
+
+      CoulombWaveFunctionArray gf, dgf;
+      coulombWaveFunctions( 4, 2.5, 0.0, gf, dgf );
+
+      CHECK( std::cos( 2.5 ) == Approx( gf[0].real() ) );
+      CHECK( std::sin( 2.5 ) == Approx( gf[0].imag() ) );
+      for ( unsigned int l = 0; l <= 4; ++l ) {
+
+        CHECK( calculatePenetrability< Neutron >( l, 2.5, 0. ) ==
+               Approx( penetrabilityFromCoulombFunctions( 2.5, gf[l] ) ) );
+      }
+      for ( unsigned int l = 1; l <= 4; ++l ) {
+
+        CHECK( calculateShiftFactor< Neutron >( l, 2.5, 0. ) ==
+               Approx( shiftFactorFromCoulombFunctions( 2.5, gf[l], dgf[l] ) ) );
+      }
+    } // THEN
+
+    THEN( "the penetrability, shift factor and phase shift can be calculated "
+          "at once" ) {
+
+      double penetrability, shiftFactor, phaseShift;
+      for ( unsigned int l = 0; l <= 3; ++l ) {
+
+        calculateWaveFunctionQuantities< ChargedParticle >(
+            l, 0.818956, 0.818956, 0.622925, 3.17996084,
+            penetrability, shiftFactor, phaseShift );
+        CHECK( calculatePenetrability< ChargedParticle >( l, 0.818956,
+                                                          3.17996084 )
+               == penetrability );
+        CHECK( calculateShiftFactor< ChargedParticle >( l, 0.818956,
+                                                        3.17996084 )
+               == shiftFactor );
+        CHECK( calculatePhaseShift< ChargedParticle >( l, 0.622925,
+                                                       3.17996084 )
+               == phaseShift );
+
+        calculateWaveFunctionQuantities< Neutron >(
+            l, 0.818956, 0.818956, 0.622925, 0.,
+            penetrability, shiftFactor, phaseShift );
+        CHECK( calculatePenetrability< Neutron >( l, 0.818956, 0. )
+               == penetrability );
+        CHECK( calculateShiftFactor< Neutron >( l, 0.818956, 0. )
+               == shiftFactor );
+        CHECK( calculatePhaseShift< Neutron >( l, 0.622925, 0. )
+               == phaseShift );
+      }
+    } // THEN
+  } // GIVEN
+} // SCENARIO
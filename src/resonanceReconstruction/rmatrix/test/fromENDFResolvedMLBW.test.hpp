@@ -182,6 +182,101 @@ SCENARIO( "fromENDF - LRF2" ) {
       CHECK( 111838.57454107259 == Approx( xs[ elas ].value ) );
       CHECK( 42264.081005233311 == Approx( xs[ capt ].value ) );
     } // THEN
+
+    THEN( "cross sections can be linearized" ) {
+
+      ReactionID elas( "n,Rh105->n,Rh105" );
+      ReactionID capt( "n,Rh105->capture" );
+
+      double relative = 1e-3;
+      double absolute = 1e-8;
+      auto table = resonances.linearize( relative, absolute );
+      auto energies = table.energies();
+      CHECK( 2 == table.numberReactions() );
+      CHECK( 1e-5 == Approx( energies.front().value ) );
+      CHECK( 7.5 == Approx( energies.back().value ) );
+
+      // the energies are sorted and contain the minimal energy grid
+      for ( unsigned int i = 1; i < table.numberEnergies(); ++i ) {
+
+        CHECK( energies[i - 1] < energies[i] );
+      }
+      for ( const auto& energy : resonances.grid() ) {
+
+        CHECK( energies.end() != std::find( energies.begin(),
+                                            energies.end(), energy ) );
+      }
+
+      // the values are the cross sections at the energies and the midpoint of
+      // every interval satisfies the tolerance
+      const auto& elastic = table.values( elas );
+      const auto& capture = table.values( capt );
+      for ( unsigned int i = 0; i < table.numberEnergies(); ++i ) {
+
+        auto xs = resonances( energies[i] );
+        CHECK( xs[ elas ].value == Approx( elastic[i] ) );
+        CHECK( xs[ capt ].value == Approx( capture[i] ) );
+
+        if ( i + 1 < table.numberEnergies() ) {
+
+          xs = resonances( 0.5 * ( energies[i] + energies[i + 1] ) );
+          for ( const auto& pair : { std::make_pair( elas, &elastic ),
+                                     std::make_pair( capt, &capture ) } ) {
+
+            const auto& values = *pair.second;
+            double exact = xs[ pair.first ].value;
+            double interpolated = 0.5 * ( values[i] + values[i + 1] );
+            CHECK( std::abs( exact - interpolated ) <=
+                   std::max( relative * std::abs( exact ), absolute ) );
+          }
+        }
+      }
+
+      // the result does not depend on the number of threads
+      for ( unsigned int threads : { 2u, 3u, 8u } ) {
+
+        auto parallel = resonances.linearize( relative, absolute, threads );
+        CHECK( table.numberEnergies() == parallel.numberEnergies() );
+        CHECK( table.values( elas ) == parallel.values( elas ) );
+        CHECK( table.values( capt ) == parallel.values( capt ) );
+      }
+    } // THEN
+
+    THEN( "cross sections can be linearized using a sink" ) {
+
+      ReactionID elas( "n,Rh105->n,Rh105" );
+      ReactionID capt( "n,Rh105->capture" );
+
+      auto table = resonances.linearize( 1e-3, 1e-8 );
+      auto energies = table.energies();
+      const auto& index = resonances.reactionIndex();
+      CHECK( 2 == index.size() );
+
+      for ( unsigned int threads : { 1u, 2u, 8u } ) {
+
+        // the chunks are given in order and contain the table values
+        unsigned int chunks = 0;
+        unsigned int i = 0;
+        resonances.linearize(
+            1e-3, 1e-8, threads,
+            [&] ( const std::vector< double >& chunk,
+                  const std::vector< double >& values ) {
+
+              ++chunks;
+              CHECK( 2 * chunk.size() == values.size() );
+              for ( unsigned int j = 0; j < chunk.size(); ++j, ++i ) {
+
+                CHECK( energies[i].value == chunk[j] );
+                CHECK( table.values( elas )[i] ==
+                       values[ 2 * j + index.slot( elas ) ] );
+                CHECK( table.values( capt )[i] ==
+                       values[ 2 * j + index.slot( capt ) ] );
+              }
+            } );
+        CHECK( resonances.grid().size() + 2 >= chunks );
+        CHECK( table.numberEnergies() == i );
+      }
+    } // THEN
   } // GIVEN
 
   GIVEN( "valid ENDF data for Ag107" ) {
@@ -1166,6 +1166,61 @@ SCENARIO( "fromENDF - LRF3" ) {
       CHECK( 7.707020e+1 == Approx( xs[ fiss ].value ) );
       CHECK( 5.625787e+1 == Approx( xs[ capt ].value ) );
     } // THEN
+
+    THEN( "cross sections can be reconstructed on an energy grid" ) {
+
+      ReactionID elas( "n,Pu239->n,Pu239" );
+      ReactionID fiss( "n,Pu239->fission" );
+      ReactionID capt( "n,Pu239->capture" );
+
+      auto table = resonances.evaluate( { 1e-5 * electronVolt,
+                                          1. * electronVolt,
+                                          10.928 * electronVolt,
+                                          1e+5 * electronVolt } );
+      CHECK( 4 == table.numberEnergies() );
+      CHECK( 3 == table.numberReactions() );
+
+      auto elastic = table.values( elas );
+      CHECK( 8.152130 == Approx( elastic[0] ) );
+      CHECK( 1.015843e+1 == Approx( elastic[1] ) );
+      CHECK( 2.126328e+1 == Approx( elastic[2] ) );
+      CHECK( 0. == Approx( elastic[3] ) );
+
+      auto fission = table.values( fiss );
+      CHECK( 3.456462e+4 == Approx( fission[0] ) );
+      CHECK( 3.948663e+1 == Approx( fission[1] ) );
+      CHECK( 1.353841e+3 == Approx( fission[2] ) );
+      CHECK( 0. == Approx( fission[3] ) );
+
+      auto capture = table.values( capt );
+      CHECK( 1.284211e+4 == Approx( capture[0] ) );
+      CHECK( 7.661602 == Approx( capture[1] ) );
+      CHECK( 3.245726e+2 == Approx( capture[2] ) );
+      CHECK( 0. == Approx( capture[3] ) );
+    } // THEN
+
+    THEN( "cross sections can be reconstructed on an energy grid using "
+          "multiple threads" ) {
+
+      std::vector< Energy > energies;
+      for ( unsigned int i = 0; i < 1000; ++i ) {
+
+        energies.push_back( 1e-5 * std::pow( 1.02, i ) * electronVolt );
+      }
+
+      auto serial = resonances.evaluate( energies );
+      for ( unsigned int threads : { 1u, 2u, 3u, 8u } ) {
+
+        auto parallel = resonances.evaluate( energies, threads );
+        CHECK( serial.numberEnergies() == parallel.numberEnergies() );
+        CHECK( serial.numberReactions() == parallel.numberReactions() );
+        for ( const auto& reaction : serial.reactions() ) {
+
+          // the values are bitwise identical to the serial values
+          CHECK( serial.values( reaction ) == parallel.values( reaction ) );
+        }
+      }
+    } // THEN
   } // GIVEN
 
   GIVEN( "valid ENDF data for Si29" ) {
@@ -0,0 +1,69 @@
+SCENARIO( "parallelFor" ) {
+
+  GIVEN( "an index range" ) {
+
+    THEN( "every index is processed exactly once for any number of threads" ) {
+
+      for ( unsigned int threads : { 1u, 2u, 3u, 16u } ) {
+
+        // the assertions are made on the calling thread
+        std::vector< unsigned int > counts( 1000, 0 );
+        std::vector< unsigned int > owners( 1000, threads );
+        std::vector< unsigned int > sizes( 1000, 0 );
+        parallelFor( 5, 995, 64, threads,
+                     [&] ( unsigned int thread,
+                           unsigned int first, unsigned int last ) {
+
+                       sizes[ first ] = last - first;
+                       for ( unsigned int i = first; i < last; ++i ) {
+
+                         ++counts[i];
+                         owners[i] = thread;
+                       }
+                     } );
+
+        for ( unsigned int i = 0; i < 1000; ++i ) {
+
+          CHECK( ( ( i >= 5 ) and ( i < 995 ) ? 1u : 0u ) == counts[i] );
+          CHECK( sizes[i] <= 64 );
+          if ( counts[i] ) {
+
+            CHECK( owners[i] < threads );
+          }
+        }
+      }
+    } // THEN
+
+    THEN( "an empty range does not call the function" ) {
+
+      unsigned int calls = 0;
+      parallelFor( 10, 10, 64, 4,
+                   [&] ( unsigned int, unsigned int, unsigned int )
+                       { ++calls; } );
+      CHECK( 0 == calls );
+    } // THEN
+
+    THEN( "the number of threads can be determined" ) {
+
+      CHECK( 1 == numberThreads( 1 ) );
+      CHECK( 4 == numberThreads( 4 ) );
+      CHECK( 1 <= numberThreads( 0 ) );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "a function that throws an exception" ) {
+
+    THEN( "the exception is rethrown on the calling thread" ) {
+
+      CHECK_THROWS( parallelFor( 0, 1000, 10, 4,
+                                 [] ( unsigned int, unsigned int first,
+                                      unsigned int ) {
+
+                                   if ( first == 500 ) {
+
+                                     throw std::exception();
+                                   }
+                                 } ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
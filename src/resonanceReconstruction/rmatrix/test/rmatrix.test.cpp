@@ -14,12 +14,15 @@ using ResonanceRange = endf::ResonanceRange;
 constexpr AtomicMass neutronMass = 1.008664 * daltons;
 constexpr ElectricalCharge elementaryCharge = 1.602e-19 * coulomb;
 
+#include "resonanceReconstruction/rmatrix/test/parallelFor.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/possibleChannelTotalAngularMomentumValues.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/possibleChannelSpinValues.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/calculatePenetrability.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/calculateShiftFactor.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/calculatePhaseShift.test.hpp"
+#include "resonanceReconstruction/rmatrix/test/calculateHardSphereFunctions.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/calculateCoulombPhaseShift.test.hpp"
+#include "resonanceReconstruction/rmatrix/test/coulombWaveFunctions.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/fromENDF.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/fromENDFResolvedSLBW.test.hpp"
 #include "resonanceReconstruction/rmatrix/test/fromENDFResolvedMLBW.test.hpp"
@@ -0,0 +1,40 @@
+/**
+ *  @brief The hard sphere penetrability, shift factor and phase shift for an
+ *         arbitrary orbital angular momentum
+ *
+ *  The values are calculated using the upward recurrence relations for the
+ *  outgoing wave function O_l = G_l + iF_l of a hard sphere:
+ *
+ *    P_l = rho^2 P_l-1 / ( ( l - S_l-1 )^2 + P_l-1^2 )
+ *    S_l = rho^2 ( l - S_l-1 ) / ( ( l - S_l-1 )^2 + P_l-1^2 ) - l
+ *    phi_l = phi_l-1 - atan( P_l-1 / ( l - S_l-1 ) )
+ *
+ *  starting from P_0 = rho, S_0 = 0 and phi_0 = rho. Since l - S_l-1 >= l,
+ *  these relations are stable for any value of rho. The phase shift is folded
+ *  so that rho - phi lies in [-pi/2,pi/2], consistent with the closed forms
+ *  used for l <= 4.
+ *
+ *  @param[in] L              the orbital angular momentum
+ *  @param[in] channelRatio   the value of rho = ka
+ *
+ *  @return the penetrability, shift factor and phase shift
+ */
+inline std::array< double, 3 >
+hardSphereFunctions( const unsigned int L, const double channelRatio ) {
+
+  const double rho2 = channelRatio * channelRatio;
+  double penetrability = channelRatio;
+  double shift = 0.;
+  double angle = 0.;
+  for ( unsigned int l = 1; l <= L; ++l ) {
+
+    const double real = l - shift;
+    const double denominator = real * real + penetrability * penetrability;
+    angle += std::atan( penetrability / real );
+    penetrability = rho2 * penetrability / denominator;
+    shift = rho2 * real / denominator - l;
+  }
+
+  angle -= pi * std::round( angle / pi );
+  return {{ penetrability, shift, channelRatio - angle }};
+}
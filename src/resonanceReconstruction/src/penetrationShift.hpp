@@ -31,7 +31,8 @@ public:
          a = rho4*rho4;
          b = 44100 + rho2*(4725 + rho2*(270 + rho2*10));
       } else {
-         throw std::exception();
+         const auto values = hardSphereFunctions(L, channelRatio);
+         return {{ (channelRatio > 0)*values[0], values[1] }};
       }
 
       return {{ (channelRatio > 0)*channelRatio*a/r, -b/r }};
@@ -9,7 +9,7 @@ inline double phaseShift( const int L, const double channelRatio ){
     case 2: offset = 3/(3-rho2); break;
     case 3: offset = (15-rho2)/(15-6*rho2); break;
     case 4: offset = (105-10*rho2)/(105+rho2*(rho2-45)); break;
-    default: throw std::exception();
+    default: return hardSphereFunctions(L, channelRatio)[2];
   };
   
   return channelRatio - std::atan( channelRatio * offset );